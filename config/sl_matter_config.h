@@ -62,6 +62,18 @@
 // <i> Default: 0
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 
+// <o CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS> Report scheduler tick in milliseconds (0 disables timer quantisation)
+// <i> Default: 1000
+#define CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS 1000
+
+// <o CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE> CASE session resumption records kept in RAM (0 disables)
+// <i> Default: 5
+#define CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE 5
+
+// <o CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE> Verified CASE peer certificate chains remembered (0 disables)
+// <i> Default: 2
+#define CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE 2
+
 // <o SL_MATTER_DEFERRED_ATTRIBUTE_STORE_DELAY_MS> Delay before the deferred attribute are stored in nvm
 // <i> Default: 2000
 #ifndef SL_MATTER_DEFERRED_ATTRIBUTE_STORE_DELAY_MS
@@ -31,6 +31,78 @@
 // state to another.
 #define ACTUATOR_MOVEMENT_PERIOS_MS 10
 
+// ---- Temperature sensor sampling and reporting ----
+
+// Bounds of the adaptive sensor sampling period. The period doubles after each
+// stable reading up to the maximum and falls back to the minimum on change.
+#ifndef SENSOR_MIN_SAMPLING_PERIOD_MS
+#define SENSOR_MIN_SAMPLING_PERIOD_MS 10000 // 10s
+#endif
+
+#ifndef SENSOR_MAX_SAMPLING_PERIOD_MS
+#define SENSOR_MAX_SAMPLING_PERIOD_MS 240000 // 4min
+#endif
+
+// A reading is considered stable when it moved by less than this amount
+// (in 0.01 degree Celsius) since the previous sample.
+#ifndef SENSOR_STABLE_TEMPERATURE_DELTA
+#define SENSOR_STABLE_TEMPERATURE_DELTA 10 // 0.1 degree Celsius
+#endif
+
+// LocalTemperature is only reported when it moved by at least this amount
+// (in 0.01 degree Celsius) since the last reported value.
+#ifndef SENSOR_REPORT_HYSTERESIS
+#define SENSOR_REPORT_HYSTERESIS 50 // 0.5 degree Celsius
+#endif
+
+// Minimum time between two LocalTemperature reports. Changes happening faster
+// are coalesced into a single report once the interval has elapsed.
+#ifndef SENSOR_MIN_REPORT_INTERVAL_MS
+#define SENSOR_MIN_REPORT_INTERVAL_MS 15000 // 15s
+#endif
+
+// Without a Si70xx sensor, simulate the room with a thermal model driven by the
+// thermostat mode and setpoints instead of replaying a fixed temperature table.
+#ifndef SENSOR_SIMULATION_THERMAL_MODEL
+#define SENSOR_SIMULATION_THERMAL_MODEL 0
+#endif
+
+// Initial ambient temperature of the thermal model (in 0.01 degree Celsius),
+// can be changed at run time with the `thermostat ambient` shell command.
+#ifndef SENSOR_SIMULATION_AMBIENT_TEMP
+#define SENSOR_SIMULATION_AMBIENT_TEMP 1500 // 15 degree Celsius
+#endif
+
+// ---- Heap profiler ----
+
+// Record every chip::Platform heap allocation by call site and size, and sample
+// the largest free heap block periodically. Printed by the `thermostat heap`
+// and `thermostat heapdump` shell commands. Debug builds only: with the defaults
+// below it takes about 9.5 KB of RAM (6 KB for the 512 slot live allocation
+// table, 2.6 KB for the sample history) and a table lookup on every allocation.
+#ifndef HEAP_PROFILER_ENABLED
+#define HEAP_PROFILER_ENABLED 0
+#endif
+
+// Number of distinct allocation sites tracked, later sites are counted together
+#ifndef HEAP_PROFILER_MAX_SITES
+#define HEAP_PROFILER_MAX_SITES 32
+#endif
+
+// Number of simultaneously live allocations tracked, the excess is counted as untracked
+#ifndef HEAP_PROFILER_MAX_LIVE_ALLOCS
+#define HEAP_PROFILER_MAX_LIVE_ALLOCS 256
+#endif
+
+// Period and depth of the free heap history, one week of hourly samples by default
+#ifndef HEAP_PROFILER_SAMPLE_PERIOD_MS
+#define HEAP_PROFILER_SAMPLE_PERIOD_MS 3600000 // 1h
+#endif
+
+#ifndef HEAP_PROFILER_SAMPLE_COUNT
+#define HEAP_PROFILER_SAMPLE_COUNT 168
+#endif
+
 // APP Logo, boolean only. must be 64x64
 #define ON_DEMO_BITMAP                                                                                                             \
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  \
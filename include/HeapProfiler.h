@@ -0,0 +1,135 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "AppConfig.h"
+
+#if HEAP_PROFILER_ENABLED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmsis_os2.h>
+#include <lib/core/CHIPError.h>
+
+/**
+ * Profile of the chip::Platform heap, fed by the allocation hooks of
+ * CHIPMem-Platform.cpp. Allocations are attributed to the return address of
+ * the chip::Platform allocation function, which the host maps back to a
+ * function with addr2line. The free heap is sampled periodically to show how
+ * the largest free block, i.e. fragmentation, evolves over long runs.
+ */
+class HeapProfiler
+{
+public:
+    // Allocation size buckets: <= 16 B, <= 32 B, ... <= 16 KiB, larger
+    static constexpr size_t kSizeBuckets = 12;
+
+    struct Totals
+    {
+        uint32_t allocs;        // Successful allocations
+        uint32_t failures;      // Allocations that returned nullptr
+        uint32_t frees;         // Frees of tracked allocations
+        uint32_t liveBytes;     // Bytes currently allocated
+        uint32_t peakLiveBytes; // Highest liveBytes seen
+        uint32_t untracked;     // Allocations not recorded because the live table was full
+    };
+
+    struct SiteStats
+    {
+        uintptr_t site; // Return address of the allocation, 0 for sites beyond HEAP_PROFILER_MAX_SITES
+        uint32_t allocs;
+        uint32_t liveCount;
+        uint32_t liveBytes;
+        uint32_t peakLiveBytes;
+    };
+
+    struct HeapSample
+    {
+        uint32_t uptimeS;
+        uint32_t freeBytes;
+        uint32_t largestFreeBlock;
+        uint32_t freeBlockCount;
+    };
+
+    CHIP_ERROR Init();
+
+    void OnAlloc(void * ptr, size_t size, void * site);
+    // Returns false if the block was not tracked, otherwise hands back its size and allocation site
+    bool OnFree(void * ptr, uint32_t * size = nullptr, uintptr_t * site = nullptr);
+    // Record again a block released by OnFree() whose realloc() then failed, leaving it allocated
+    void OnReallocFailed(void * ptr, uint32_t size, uintptr_t site);
+
+    Totals GetTotals() const;
+    // Copy out the stats of a tracked site, false once index is past the last one
+    bool GetSite(size_t index, SiteStats & out) const;
+    uint32_t GetSizeBucketCount(size_t bucket) const;
+    // Largest size counted in a bucket, 0 for the last, unbounded, bucket
+    static uint32_t GetSizeBucketLimit(size_t bucket);
+    // Copy out a free heap sample, oldest first, false once index is past the last one
+    bool GetSample(size_t index, HeapSample & out) const;
+    // Read the current state of the heap, in the same form as the periodic samples
+    static void ReadHeap(HeapSample & out);
+
+private:
+    friend HeapProfiler & HeapProf();
+
+    static constexpr uint16_t kNoSite  = UINT16_MAX;
+    static constexpr size_t kOtherSite = HEAP_PROFILER_MAX_SITES;
+    static constexpr size_t kLiveSlots = HEAP_PROFILER_MAX_LIVE_ALLOCS * 2;
+    static constexpr uintptr_t kNoLive = 0;
+
+    struct LiveAlloc
+    {
+        uintptr_t ptr; // kNoLive for a free slot
+        uint32_t size;
+        uint16_t site;
+    };
+
+    static size_t LiveHome(uintptr_t ptr);
+    static size_t SizeBucket(size_t size);
+    static void SampleTimerHandler(void * arg);
+
+    uint16_t FindOrAddSite(uintptr_t site);
+    void RemoveLive(size_t slot);
+    void TakeSample();
+
+    Totals mTotals = {};
+    // The extra entry accumulates every site past HEAP_PROFILER_MAX_SITES
+    SiteStats mSites[HEAP_PROFILER_MAX_SITES + 1] = {};
+    size_t mSiteCount                             = 0;
+    // Open addressed by pointer, at most half full
+    LiveAlloc mLive[kLiveSlots]         = {};
+    size_t mLiveCount                   = 0;
+    uint32_t mSizeBuckets[kSizeBuckets] = {};
+
+    HeapSample mSamples[HEAP_PROFILER_SAMPLE_COUNT] = {};
+    size_t mSampleCount                             = 0;
+    size_t mNextSample                              = 0;
+    osTimerId_t mSampleTimer                        = nullptr;
+
+    static HeapProfiler sHeapProfiler;
+};
+
+inline HeapProfiler & HeapProf()
+{
+    return HeapProfiler::sHeapProfiler;
+}
+
+#endif // HEAP_PROFILER_ENABLED
@@ -21,7 +21,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "AppConfig.h"
 #include "AppEvent.h"
+#include "ThermalModel.h"
 
 #include <app-common/zap-generated/attributes/Accessors.h>
 #include <cmsis_os2.h>
@@ -32,15 +34,39 @@ class SensorManager
 public:
     CHIP_ERROR Init();
 
+#if SENSOR_SIMULATION_THERMAL_MODEL
+    ThermalModel & GetThermalModel() { return mThermalModel; }
+#endif // SENSOR_SIMULATION_THERMAL_MODEL
+
 private:
     friend SensorManager & SensorMgr();
 
     osTimerId_t mSensorTimer;
 
+    // Adaptive sampling and reporting state, temperatures in 0.01 degree Celsius
+    uint32_t mSamplingPeriodMs  = 0;
+    uint32_t mNextSampleDelayMs = 0; // mSamplingPeriodMs, or less once when a rate limited change must be reported
+    int16_t mLastSampledTemp    = 0;
+    int16_t mLastReportedTemp   = 0;
+    uint64_t mLastReportTimeMs  = 0;
+    bool mHasReportedTemp       = false;
+    bool mFixedPeriod           = false; // The one-shot timer could not be re-armed, a periodic timer took over
+
+#if SENSOR_SIMULATION_THERMAL_MODEL
+    ThermalModel mThermalModel;
+    uint64_t mLastModelStepMs = 0;
+#endif // SENSOR_SIMULATION_THERMAL_MODEL
+
     static void SensorTimerEventHandler(void * arg);
     // Reads new generated sensor value, stores it, and updates local temperature attribute
     static void TemperatureUpdateEventHandler(AppEvent * aEvent);
 
+    static int16_t ReadTemperature();
+    // Computes the next sampling period and whether the new sample must be reported
+    chip::app::MarkAttributeDirty ProcessSample(int16_t temperature);
+    // Re-arms the sensor timer for the next sample
+    void ScheduleNextSample();
+
     static SensorManager sSensorManager;
 };
 
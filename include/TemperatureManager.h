@@ -40,7 +40,13 @@ class TemperatureManager
 {
 public:
     CHIP_ERROR Init();
-    void AttributeChangeHandler(EndpointId endpointId, AttributeId attributeId, uint8_t * value, uint16_t size);
+
+    // Thermostat attribute change handlers, values are in the Ember storage representation
+    void LocalTemperatureChangeHandler(int16_t temperature);
+    void CoolingSetpointChangeHandler(int16_t setpoint);
+    void HeatingSetpointChangeHandler(int16_t setpoint);
+    void SystemModeChangeHandler(uint8_t mode);
+
     uint8_t GetMode();
     int8_t GetCurrentTemp();
     int8_t GetHeatingSetPoint();
@@ -55,6 +61,10 @@ private:
     uint8_t mThermMode;
 
     int8_t ConvertToPrintableTemp(int16_t temperature);
+    // Stores a displayed value and refreshes the UI only when it changed
+    template <typename T>
+    void UpdateDisplayedValue(T & displayedValue, T newValue);
+
     static TemperatureManager sTempMgr;
 };
 
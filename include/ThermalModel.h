@@ -0,0 +1,64 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * First order thermal model of a room heated or cooled by the thermostat.
+ *
+ * Used as a simulated temperature source when no sensor is available. The room
+ * drifts towards the ambient temperature and the HVAC equipment, switched on by
+ * the thermostat mode and setpoints, adds or removes heat at a fixed rate.
+ * All temperatures are in 0.01 degree Celsius.
+ */
+class ThermalModel
+{
+public:
+    enum class HvacState : uint8_t
+    {
+        kIdle = 0,
+        kHeating,
+        kCooling,
+    };
+
+    void Init(int16_t roomTemp, int16_t ambientTemp);
+
+    /**
+     * @brief Advances the model and returns the new room temperature
+     *
+     * @param elapsedMs time elapsed since the previous step
+     * @param mode thermostat mode, see ThermMode
+     * @param heatingSetpoint occupied heating setpoint
+     * @param coolingSetpoint occupied cooling setpoint
+     */
+    int16_t Step(uint32_t elapsedMs, uint8_t mode, int16_t heatingSetpoint, int16_t coolingSetpoint);
+
+    void SetAmbientTemp(int16_t ambientTemp) { mAmbientTemp = ambientTemp; }
+    int16_t GetAmbientTemp() const { return mAmbientTemp; }
+    int16_t GetRoomTemp() const { return static_cast<int16_t>(mRoomTemp); }
+    HvacState GetHvacState() const { return mHvacState; }
+
+private:
+    HvacState ComputeHvacState(uint8_t mode, int16_t heatingSetpoint, int16_t coolingSetpoint) const;
+
+    float mRoomTemp      = 0;
+    int16_t mAmbientTemp = 0;
+    HvacState mHvacState = HvacState::kIdle;
+};
@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <lib/core/CHIPError.h>
+
+/**
+ * Counters of the thermostat control loop, used to quantify the cost of the
+ * sensor reporting and UI paths. They are printed by the `thermostat stats`
+ * shell command, normalised per hour of run time.
+ *
+ * The counters are updated from the app and CHIP tasks and read from the
+ * shell, always with the CHIP stack locked.
+ */
+class ThermostatStats
+{
+public:
+    struct Counters
+    {
+        uint32_t sensorSamples;      // Sensor readings taken
+        uint32_t temperatureChanges; // Readings that differ from the previous one
+        uint32_t reportsTriggered;   // Readings that marked LocalTemperature dirty
+        uint32_t attributeChanges;   // Thermostat attribute change callbacks
+        uint32_t uiRefreshes;        // Thermostat UI updates
+        uint64_t sensorCpuTimeUs;    // Time spent handling sensor readings
+        uint64_t attributeCpuTimeUs; // Time spent handling attribute changes, UI refresh included
+    };
+
+    CHIP_ERROR Init();
+    void Reset();
+
+    void OnSensorSample(bool changed, bool reported, uint64_t cpuTimeUs);
+    void OnAttributeChange(uint64_t cpuTimeUs);
+    void OnUIRefresh() { mCounters.uiRefreshes++; }
+
+    const Counters & GetCounters() const { return mCounters; }
+    // Time elapsed since the counters were last reset
+    uint64_t GetElapsedMs() const;
+    // Report scheduler timer wakeups since the counters were last reset
+    uint32_t GetReportWakeups() const;
+    // MRP standalone acks sent since the counters were last reset
+    uint32_t GetStandaloneAcks() const;
+
+    static uint64_t GetTimestampUs();
+
+private:
+    friend ThermostatStats & ThermoStats();
+
+    Counters mCounters    = {};
+    uint64_t mStartTimeMs = 0;
+    // Report scheduler wakeup count at the last reset, the scheduler counter itself is never cleared
+    uint32_t mReportWakeupsAtReset = 0;
+    // MRP standalone ack count at the last reset
+    uint32_t mStandaloneAcksAtReset = 0;
+
+    static ThermostatStats sThermostatStats;
+};
+
+inline ThermostatStats & ThermoStats()
+{
+    return ThermostatStats::sThermostatStats;
+}
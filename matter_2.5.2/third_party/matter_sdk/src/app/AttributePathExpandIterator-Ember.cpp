@@ -216,11 +216,13 @@ bool AttributePathExpandIteratorEmber::Next()
             for (; mClusterIndex < mEndClusterIndex;
                  (mClusterIndex++, mAttributeIndex = UINT16_MAX, mGlobalAttributeIndex = UINT8_MAX))
             {
-                // emberAfGetNthClusterId must return a valid cluster id here since we have verified the mClusterIndex does
-                // not exceed the mEndClusterIndex.
-                ClusterId clusterId = emberAfGetNthClusterId(endpointId, mClusterIndex, true /* server */).Value();
+                // While we are in the middle of a cluster, mOutputPath still holds its id from the previous call.
+                ClusterId clusterId = mOutputPath.mClusterId;
                 if (mAttributeIndex == UINT16_MAX && mGlobalAttributeIndex == UINT8_MAX)
                 {
+                    // emberAfGetNthClusterId must return a valid cluster id here since we have verified the mClusterIndex does
+                    // not exceed the mEndClusterIndex.
+                    clusterId = emberAfGetNthClusterId(endpointId, mClusterIndex, true /* server */).Value();
                     PrepareAttributeIndexRange(mpAttributePath->mValue, endpointId, clusterId);
                 }
 
@@ -99,6 +99,18 @@ public:
      */
     void ResetCurrentCluster();
 
+    /**
+     * Skip the attributes of the current cluster that have not been emitted yet, so the following Next() call moves to the
+     * next cluster (or the next path in the list).
+     *
+     * Used by the reporting engine to skip a whole cluster of a wildcard path once it knows nothing in it is dirty.
+     */
+    void SkipCurrentCluster()
+    {
+        mAttributeIndex       = mEndAttributeIndex;
+        mGlobalAttributeIndex = mGlobalAttributeEndIndex;
+    }
+
     /** Start iterating over the given `paths` */
     inline void ResetTo(SingleLinkedListNode<AttributePathParams> * paths)
     {
@@ -64,6 +64,27 @@ public:
             return mAttributeValueEncoder.EncodeListItem(std::forward<T>(aArg));
         }
 
+        /**
+         * Returns true, and moves past the next list item, if that item was already encoded in a previous chunk of this report.
+         * List generators whose items are expensive to build (storage reads, certificate fetches, owned copies) call this before
+         * building the next item and go straight to the following one when it returns true, instead of building an item that
+         * Encode() would drop. Generators that do not call it keep working unchanged.
+         */
+        bool SkipIfAlreadyEncoded() const { return mAttributeValueEncoder.SkipListItemIfAlreadyEncoded(); }
+
+        /**
+         * Same as SkipIfAlreadyEncoded() for fabric-scoped items, given the fabric index of the next item. Also returns true for
+         * items that fabric filtering would drop, which do not count as encoded list items.
+         */
+        bool SkipIfAlreadyEncoded(FabricIndex aFabricIndex) const
+        {
+            VerifyOrReturnValue(aFabricIndex != kUndefinedFabricIndex, false);
+            VerifyOrReturnValue(!mAttributeValueEncoder.mIsFabricFiltered ||
+                                    aFabricIndex == mAttributeValueEncoder.AccessingFabricIndex(),
+                                true);
+            return SkipIfAlreadyEncoded();
+        }
+
     private:
         AttributeValueEncoder & mAttributeValueEncoder;
     };
@@ -169,10 +190,9 @@ private:
     {
         // EncodeListItem must be called after EnsureListStarted(), thus mCurrentEncodingListIndex and
         // mEncodeState.mCurrentEncodingListIndex are not invalid values.
-        if (mCurrentEncodingListIndex < mEncodeState.CurrentEncodingListIndex())
+        if (SkipListItemIfAlreadyEncoded())
         {
             // We have encoded this element in previous chunks, skip it.
-            mCurrentEncodingListIndex++;
             return CHIP_NO_ERROR;
         }
 
@@ -205,6 +225,18 @@ private:
         return CHIP_NO_ERROR;
     }
 
+    /**
+     * Moves past the next list item if it was already encoded in a previous chunk.
+     *
+     * @return true if the item was skipped, false if it still needs to be encoded.
+     */
+    bool SkipListItemIfAlreadyEncoded()
+    {
+        VerifyOrReturnValue(mCurrentEncodingListIndex < mEncodeState.CurrentEncodingListIndex(), false);
+        mCurrentEncodingListIndex++;
+        return true;
+    }
+
     /**
      * Builds a single AttributeReportIB in AttributeReportIBs.  The caller is
      * responsible for setting up mPath correctly.
@@ -80,6 +80,32 @@ struct CopyAndAdjustDeltaTimeContext
     EventLoadOutContext * mpContext = nullptr;
 };
 
+namespace {
+
+/**
+ * @brief
+ *  Pack a path whose endpoint and event ids fit in a byte and whose cluster id fits in 16 bits (every standard
+ *  cluster on a typical device) into a single integer, so the stored event does not carry a full EventPathIB list.
+ */
+bool PackEventPath(const ConcreteEventPath & aPath, uint32_t & aPacked)
+{
+    if (aPath.mEndpointId > UINT8_MAX || aPath.mClusterId > UINT16_MAX || aPath.mEventId > UINT8_MAX)
+    {
+        return false;
+    }
+    aPacked = static_cast<uint32_t>(aPath.mClusterId) | (static_cast<uint32_t>(aPath.mEventId) << 16) |
+              (static_cast<uint32_t>(aPath.mEndpointId) << 24);
+    return true;
+}
+
+ConcreteEventPath UnpackEventPath(uint32_t aPacked)
+{
+    return ConcreteEventPath(static_cast<EndpointId>(aPacked >> 24), static_cast<ClusterId>(aPacked & 0xFFFF),
+                             static_cast<EventId>((aPacked >> 16) & 0xFF));
+}
+
+} // namespace
+
 void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint32_t aNumBuffers,
                            CircularEventBuffer * apCircularEventBuffer, const LogStorageResources * const apLogStorageResources,
                            MonotonicallyIncreasingCounter<EventNumber> * apEventNumberCounter,
@@ -118,6 +144,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
 
     mpEventNumberCounter = apEventNumberCounter;
     mLastEventNumber     = mpEventNumberCounter->GetValue();
+    mEventNumberBase     = mLastEventNumber;
 
     mpEventBuffer = apCircularEventBuffer;
     mState        = EventManagementStates::Idle;
@@ -298,15 +325,27 @@ CHIP_ERROR EventManagement::ConstructEvent(EventLoadOutContext * apContext, Even
     ReturnErrorOnFailure(eventReportBuilder.Init(&(apContext->mWriter)));
     EventDataIB::Builder & eventDataIBBuilder = eventReportBuilder.CreateEventData();
     ReturnErrorOnFailure(eventReportBuilder.GetError());
-    EventPathIB::Builder & eventPathBuilder = eventDataIBBuilder.CreatePath();
-    ReturnErrorOnFailure(eventDataIBBuilder.GetError());
 
-    CHIP_ERROR err = eventPathBuilder.Endpoint(apOptions->mPath.mEndpointId)
-                         .Cluster(apOptions->mPath.mClusterId)
-                         .Event(apOptions->mPath.mEventId)
-                         .EndOfEventPathIB();
-    ReturnErrorOnFailure(err);
-    eventDataIBBuilder.EventNumber(apContext->mCurrentEventNumber).Priority(chip::to_underlying(apContext->mPriority));
+    // The stored copy of the event is kept compact: the path is packed into one integer when it fits and the event
+    // number is relative to mEventNumberBase.  CopyAndAdjustDeltaTime restores the wire encoding of both.
+    uint32_t packedPath;
+    if (PackEventPath(apOptions->mPath, packedPath))
+    {
+        ReturnErrorOnFailure(apContext->mWriter.Put(TLV::ContextTag(kCompactPathTag), packedPath));
+    }
+    else
+    {
+        EventPathIB::Builder & eventPathBuilder = eventDataIBBuilder.CreatePath();
+        ReturnErrorOnFailure(eventDataIBBuilder.GetError());
+
+        CHIP_ERROR err = eventPathBuilder.Endpoint(apOptions->mPath.mEndpointId)
+                             .Cluster(apOptions->mPath.mClusterId)
+                             .Event(apOptions->mPath.mEventId)
+                             .EndOfEventPathIB();
+        ReturnErrorOnFailure(err);
+    }
+    eventDataIBBuilder.EventNumber(apContext->mCurrentEventNumber - mEventNumberBase)
+        .Priority(chip::to_underlying(apContext->mPriority));
     ReturnErrorOnFailure(eventDataIBBuilder.GetError());
 
     if (apOptions->mTimestamp.IsSystem())
@@ -323,12 +362,12 @@ CHIP_ERROR EventManagement::ConstructEvent(EventLoadOutContext * apContext, Even
     // Callback to write the EventData
     ReturnErrorOnFailure(apDelegate->WriteEvent(apContext->mWriter));
 
-    // The fabricIndex profile tag is internal use only for fabric filtering when retrieving event from circular event buffer,
+    // The fabricIndex context tag is internal use only for fabric filtering when retrieving event from circular event buffer,
     // and would not go on the wire.
     // Revisit FabricRemovedCB function should the encoding of fabricIndex change in the future.
     if (apOptions->mFabricIndex != kUndefinedFabricIndex)
     {
-        apContext->mWriter.Put(TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag), apOptions->mFabricIndex);
+        apContext->mWriter.Put(TLV::ContextTag(kFabricIndexTag), apOptions->mFabricIndex);
     }
     ReturnErrorOnFailure(eventDataIBBuilder.EndOfEventDataIB());
     ReturnErrorOnFailure(eventReportBuilder.EndOfEventReportIB());
@@ -375,11 +414,25 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
     CopyAndAdjustDeltaTimeContext * ctx = static_cast<CopyAndAdjustDeltaTimeContext *>(apContext);
     TLVReader reader(aReader);
 
-    if (aReader.GetTag() == TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+    if (aReader.GetTag() == TLV::ContextTag(kFabricIndexTag))
     {
         // Does not go on the wire.
         return CHIP_NO_ERROR;
     }
+    if (aReader.GetTag() == TLV::ContextTag(kCompactPathTag))
+    {
+        uint32_t packedPath;
+        ReturnErrorOnFailure(reader.Get(packedPath));
+        ConcreteEventPath path = UnpackEventPath(packedPath);
+        EventPathIB::Builder pathBuilder;
+        ReturnErrorOnFailure(pathBuilder.Init(ctx->mpWriter, to_underlying(EventDataIB::Tag::kPath)));
+        return pathBuilder.Endpoint(path.mEndpointId).Cluster(path.mClusterId).Event(path.mEventId).EndOfEventPathIB();
+    }
+    if (aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEventNumber))
+    {
+        // The stored number is relative; EventIterator has already resolved the absolute one.
+        return ctx->mpWriter->Put(TLV::ContextTag(EventDataIB::Tag::kEventNumber), ctx->mpContext->mCurrentEventNumber);
+    }
     if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp)) && !(ctx->mpContext->mFirst) &&
         (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType))
     {
@@ -696,7 +749,7 @@ CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size
 
     while (CHIP_NO_ERROR == event.Next())
     {
-        if (event.GetTag() == TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+        if (event.GetTag() == TLV::ContextTag(kFabricIndexTag))
         {
             uint8_t fabricIndex = 0;
             VerifyOrReturnError(event.Get(fabricIndex) == CHIP_NO_ERROR, CHIP_NO_ERROR);
@@ -769,6 +822,17 @@ CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size
         envelope->mFieldsToRead |= 1 << to_underlying(EventDataIB::Tag::kPath);
     }
 
+    if (reader.GetTag() == TLV::ContextTag(kCompactPathTag))
+    {
+        uint32_t packedPath;
+        ReturnErrorOnFailure(reader.Get(packedPath));
+        ConcreteEventPath path = UnpackEventPath(packedPath);
+        envelope->mEndpointId  = path.mEndpointId;
+        envelope->mClusterId   = path.mClusterId;
+        envelope->mEventId     = path.mEventId;
+        envelope->mFieldsToRead |= 1 << to_underlying(EventDataIB::Tag::kPath);
+    }
+
     if (reader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kPriority))
     {
         uint16_t extPriority; // Note: the type here matches the type case in EventManagement::LogEvent, priority section
@@ -780,6 +844,7 @@ CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size
     if (reader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEventNumber))
     {
         ReturnErrorOnFailure(reader.Get(envelope->mEventNumber));
+        envelope->mEventNumber += GetInstance().mEventNumberBase;
     }
 
     if (reader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp))
@@ -798,7 +863,7 @@ CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size
         envelope->mCurrentTime.mValue = epochTime;
     }
 
-    if (reader.GetTag() == TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+    if (reader.GetTag() == TLV::ContextTag(kFabricIndexTag))
     {
         uint8_t fabricIndex = kUndefinedFabricIndex;
         ReturnErrorOnFailure(reader.Get(fabricIndex));
@@ -71,9 +71,11 @@
 
 namespace chip {
 namespace app {
-inline constexpr const uint32_t kEventManagementProfile = 0x1;
-inline constexpr const uint32_t kFabricIndexTag         = 0x1;
-inline constexpr size_t kMaxEventSizeReserve            = 512;
+// Context tags that only exist inside the event buffers.  They sit outside the EventDataIB tag range and are
+// rewritten or dropped by CopyAndAdjustDeltaTime before an event goes on the wire.
+inline constexpr const uint8_t kFabricIndexTag = 0xFE; ///< Fabric index of a fabric-scoped event
+inline constexpr const uint8_t kCompactPathTag = 0xFD; ///< Endpoint, cluster and event id packed into a single integer
+inline constexpr size_t kMaxEventSizeReserve   = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
@@ -560,6 +562,7 @@ private:
     MonotonicallyIncreasingCounter<EventNumber> * mpEventNumberCounter = nullptr;
 
     EventNumber mLastEventNumber = 0; ///< Last event Number vended
+    EventNumber mEventNumberBase = 0; ///< Event numbers are stored in the buffers relative to this value
     Timestamp mLastEventTimestamp;    ///< The timestamp of the last event in this buffer
 
     System::Clock::Milliseconds64 mMonotonicStartupTime;
@@ -121,6 +121,8 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
         }
     }
 
+    UpdateAttributeInterestBucketMask();
+
     mSessionHandle.Grab(sessionHandle);
 
     SetStateFlag(ReadHandlerFlags::ActiveSubscription);
@@ -512,11 +514,21 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     {
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
         mAttributePathExpandIterator.ResetTo(mpAttributePathList);
+        UpdateAttributeInterestBucketMask();
         err = CHIP_NO_ERROR;
     }
     return err;
 }
 
+void ReadHandler::UpdateAttributeInterestBucketMask()
+{
+    mAttributeInterestBucketMask = 0;
+    for (auto path = mpAttributePathList; path != nullptr; path = path->mpNext)
+    {
+        mAttributeInterestBucketMask |= reporting::Engine::GetDirtyClusterBucketMask(path->mValue);
+    }
+}
+
 CHIP_ERROR ReadHandler::ProcessDataVersionFilterList(DataVersionFilterIBs::Parser & aDataVersionFilterListParser)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
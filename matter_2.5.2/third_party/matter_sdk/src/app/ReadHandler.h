@@ -495,6 +495,7 @@ private:
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePaths(AttributePathIBs::Parser & aAttributePathListParser);
+    void UpdateAttributeInterestBucketMask();
     CHIP_ERROR ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser);
     CHIP_ERROR ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser);
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload,
@@ -589,6 +590,10 @@ private:
 
     uint32_t mLastWrittenEventsBytes = 0;
 
+    // Union of the reporting engine dirty cluster buckets covered by mpAttributePathList, refreshed whenever the path list
+    // is populated. Lets Engine::SetDirty skip this handler without walking its path list.
+    uint32_t mAttributeInterestBucketMask = 0;
+
     // The detailed encoding state for a single attribute, used by list chunking feature.
     // The size of AttributeEncoderState is 2 bytes for now.
     AttributeEncodeState mAttributeEncoderState;
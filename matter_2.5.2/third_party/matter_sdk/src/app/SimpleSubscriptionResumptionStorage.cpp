@@ -93,6 +93,12 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Init(PersistentStorageDelegate *
     VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     mStorage = storage;
 
+    // Kept for the lifetime of the storage, see mScratchBuffer for its RAM cost
+    if (mScratchBuffer.Get() == nullptr)
+    {
+        ReturnErrorCodeIf(mScratchBuffer.Calloc(MaxSubscriptionSize()).Get() == nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
     uint16_t countMax;
     uint16_t len = sizeof(countMax);
     CHIP_ERROR err =
@@ -141,15 +147,14 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(uint16_t subscriptionInde
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo)
 {
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-    backingBuffer.Calloc(MaxSubscriptionSize());
-    ReturnErrorCodeIf(backingBuffer.Get() == nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorCodeIf(mScratchBuffer.Get() == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
     uint16_t len = static_cast<uint16_t>(MaxSubscriptionSize());
     ReturnErrorOnFailure(mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
-                                                   backingBuffer.Get(), len));
+                                                   mScratchBuffer.Get(), len));
 
-    TLV::ScopedBufferTLVReader reader(std::move(backingBuffer), len);
+    TLV::TLVReader reader;
+    reader.Init(mScratchBuffer.Get(), len);
 
     ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
 
@@ -369,22 +374,20 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
     }
 
     // Now construct subscription state and save
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-    backingBuffer.Calloc(MaxSubscriptionSize());
-    ReturnErrorCodeIf(backingBuffer.Get() == nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorCodeIf(mScratchBuffer.Get() == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxSubscriptionSize());
+    TLV::TLVWriter writer;
+    writer.Init(mScratchBuffer.Get(), MaxSubscriptionSize());
 
     ReturnErrorOnFailure(Save(writer, subscriptionInfo));
+    ReturnErrorOnFailure(writer.Finalize());
 
     const auto len = writer.GetLengthWritten();
     VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    writer.Finalize(backingBuffer);
-
     ReturnErrorOnFailure(
         mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(firstEmptySubscriptionIndex).KeyName(),
-                                  backingBuffer.Get(), static_cast<uint16_t>(len)));
+                                  mScratchBuffer.Get(), static_cast<uint16_t>(len)));
 
     return CHIP_NO_ERROR;
 }
@@ -136,6 +136,11 @@ protected:
 
     PersistentStorageDelegate * mStorage;
     ObjectPool<SimpleSubscriptionInfoIterator, kIteratorsMax> mSubscriptionInfoIterators;
+    // TLV scratch space of MaxSubscriptionSize() bytes, allocated once in Init and shared by every Load and Save so that
+    // subscribing and unsubscribing do not churn the heap.  Load and Save never hold it across calls.  This is a permanent
+    // heap allocation that grows with CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS: 2676 bytes with the Silabs
+    // default of 5 fabrics (15 subscriptions, 45 path groups), where the allocations it replaces were only transient.
+    Platform::ScopedMemoryBuffer<uint8_t> mScratchBuffer;
 };
 } // namespace app
 } // namespace chip
@@ -123,12 +123,17 @@ CHIP_ERROR OperationalCredentialsAttrAccess::ReadNOCs(EndpointId endpoint, Attri
         const auto & fabricTable = Server::GetInstance().GetFabricTable();
         for (const auto & fabricInfo : fabricTable)
         {
+            FabricIndex fabricIndex = fabricInfo.GetFabricIndex();
+            if (encoder.SkipIfAlreadyEncoded(fabricIndex))
+            {
+                continue;
+            }
+
             Clusters::OperationalCredentials::Structs::NOCStruct::Type noc;
             uint8_t nocBuf[kMaxCHIPCertLength];
             uint8_t icacBuf[kMaxCHIPCertLength];
             MutableByteSpan nocSpan{ nocBuf };
             MutableByteSpan icacSpan{ icacBuf };
-            FabricIndex fabricIndex = fabricInfo.GetFabricIndex();
 
             noc.fabricIndex = fabricIndex;
 
@@ -171,8 +176,13 @@ CHIP_ERROR OperationalCredentialsAttrAccess::ReadFabricsList(EndpointId endpoint
 
         for (const auto & fabricInfo : fabricTable)
         {
-            Clusters::OperationalCredentials::Structs::FabricDescriptorStruct::Type fabricDescriptor;
             FabricIndex fabricIndex = fabricInfo.GetFabricIndex();
+            if (encoder.SkipIfAlreadyEncoded(fabricIndex))
+            {
+                continue;
+            }
+
+            Clusters::OperationalCredentials::Structs::FabricDescriptorStruct::Type fabricDescriptor;
 
             fabricDescriptor.fabricIndex = fabricIndex;
             fabricDescriptor.nodeID      = fabricInfo.GetPeerId().GetNodeId();
@@ -200,6 +210,10 @@ CHIP_ERROR OperationalCredentialsAttrAccess::ReadRootCertificates(EndpointId end
 
         for (const auto & fabricInfo : fabricTable)
         {
+            if (encoder.SkipIfAlreadyEncoded())
+            {
+                continue;
+            }
             uint8_t certBuf[kMaxCHIPCertLength];
             MutableByteSpan cert{ certBuf };
             ReturnErrorOnFailure(fabricTable.FetchRootCert(fabricInfo.GetFabricIndex(), cert));
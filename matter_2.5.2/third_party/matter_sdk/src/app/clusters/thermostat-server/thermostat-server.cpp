@@ -41,12 +41,8 @@ using namespace Protocols::InteractionModel;
 
 constexpr int16_t kDefaultAbsMinHeatSetpointLimit = 700;  // 7C (44.5 F) is the default
 constexpr int16_t kDefaultAbsMaxHeatSetpointLimit = 3000; // 30C (86 F) is the default
-constexpr int16_t kDefaultMinHeatSetpointLimit    = 700;  // 7C (44.5 F) is the default
-constexpr int16_t kDefaultMaxHeatSetpointLimit    = 3000; // 30C (86 F) is the default
 constexpr int16_t kDefaultAbsMinCoolSetpointLimit = 1600; // 16C (61 F) is the default
 constexpr int16_t kDefaultAbsMaxCoolSetpointLimit = 3200; // 32C (90 F) is the default
-constexpr int16_t kDefaultMinCoolSetpointLimit    = 1600; // 16C (61 F) is the default
-constexpr int16_t kDefaultMaxCoolSetpointLimit    = 3200; // 32C (90 F) is the default
 constexpr int16_t kDefaultHeatingSetpoint         = 2000;
 constexpr int16_t kDefaultCoolingSetpoint         = 2600;
 constexpr int8_t kDefaultDeadBand                 = 25; // 2.5C is the default
@@ -71,31 +67,33 @@ static_assert(kThermostatEndpointCount <= kEmberInvalidEndpointIndex, "Thermosta
 
 Delegate * gDelegateTable[kThermostatEndpointCount] = { nullptr };
 
-namespace chip {
-namespace app {
-namespace Clusters {
-namespace Thermostat {
+namespace {
 
-ThermostatAttrAccess gThermostatAttrAccess;
-
-int16_t EnforceHeatingSetpointLimits(int16_t HeatingSetpoint, EndpointId endpoint)
+// Feature map, setpoint limits and deadband of a thermostat endpoint. They are read from the attribute store on first use
+// and kept until one of them changes, see MatterThermostatClusterServerAttributeChangedCallback, so that validating a
+// setpoint only costs a few comparisons.
+struct SetpointLimits
+{
+    bool valid;
+    uint32_t featureMap;
+    int16_t absMinHeat;
+    int16_t absMaxHeat;
+    int16_t minHeat;
+    int16_t maxHeat;
+    int16_t absMinCool;
+    int16_t absMaxCool;
+    int16_t minCool;
+    int16_t maxCool;
+    int8_t deadBand;
+};
+
+SetpointLimits gSetpointLimits[kThermostatEndpointCount];
+
+void LoadSetpointLimits(EndpointId endpoint, SetpointLimits & limits)
 {
-    // Optional Mfg supplied limits
-    int16_t AbsMinHeatSetpointLimit = kDefaultAbsMinHeatSetpointLimit;
-    int16_t AbsMaxHeatSetpointLimit = kDefaultAbsMaxHeatSetpointLimit;
-
-    // Optional User supplied limits
-    int16_t MinHeatSetpointLimit = kDefaultMinHeatSetpointLimit;
-    int16_t MaxHeatSetpointLimit = kDefaultMaxHeatSetpointLimit;
-
-    // Attempt to read the setpoint limits
     // Absmin/max are manufacturer limits
     // min/max are user imposed min/max
 
-    // Note that the limits are initialized above per the spec limits
-    // if they are not present Get() will not update the value so the defaults are used
-    Status status;
-
     // https://github.com/CHIP-Specifications/connectedhomeip-spec/issues/3724
     // behavior is not specified when Abs * values are not present and user values are present
     // implemented behavior accepts the user values without regard to default Abs values.
@@ -103,28 +101,98 @@ int16_t EnforceHeatingSetpointLimits(int16_t HeatingSetpoint, EndpointId endpoin
     // Per global matter data model policy
     // if a attribute is not present then it's default shall be used.
 
-    status = AbsMinHeatSetpointLimit::Get(endpoint, &AbsMinHeatSetpointLimit);
-    if (status != Status::Success)
+    if (FeatureMap::Get(endpoint, &limits.featureMap) != Status::Success)
+        limits.featureMap = FEATURE_MAP_DEFAULT;
+
+    if (MinSetpointDeadBand::Get(endpoint, &limits.deadBand) != Status::Success)
+        limits.deadBand = kDefaultDeadBand;
+
+    if (AbsMinHeatSetpointLimit::Get(endpoint, &limits.absMinHeat) != Status::Success)
     {
         ChipLogError(Zcl, "Warning: AbsMinHeatSetpointLimit missing using default");
+        limits.absMinHeat = kDefaultAbsMinHeatSetpointLimit;
     }
 
-    status = AbsMaxHeatSetpointLimit::Get(endpoint, &AbsMaxHeatSetpointLimit);
-    if (status != Status::Success)
+    if (AbsMaxHeatSetpointLimit::Get(endpoint, &limits.absMaxHeat) != Status::Success)
     {
         ChipLogError(Zcl, "Warning: AbsMaxHeatSetpointLimit missing using default");
+        limits.absMaxHeat = kDefaultAbsMaxHeatSetpointLimit;
     }
-    status = MinHeatSetpointLimit::Get(endpoint, &MinHeatSetpointLimit);
-    if (status != Status::Success)
+
+    if (MinHeatSetpointLimit::Get(endpoint, &limits.minHeat) != Status::Success)
+        limits.minHeat = limits.absMinHeat;
+
+    if (MaxHeatSetpointLimit::Get(endpoint, &limits.maxHeat) != Status::Success)
+        limits.maxHeat = limits.absMaxHeat;
+
+    if (AbsMinCoolSetpointLimit::Get(endpoint, &limits.absMinCool) != Status::Success)
     {
-        MinHeatSetpointLimit = AbsMinHeatSetpointLimit;
+        ChipLogError(Zcl, "Warning: AbsMinCoolSetpointLimit missing using default");
+        limits.absMinCool = kDefaultAbsMinCoolSetpointLimit;
     }
 
-    status = MaxHeatSetpointLimit::Get(endpoint, &MaxHeatSetpointLimit);
-    if (status != Status::Success)
+    if (AbsMaxCoolSetpointLimit::Get(endpoint, &limits.absMaxCool) != Status::Success)
     {
-        MaxHeatSetpointLimit = AbsMaxHeatSetpointLimit;
+        ChipLogError(Zcl, "Warning: AbsMaxCoolSetpointLimit missing using default");
+        limits.absMaxCool = kDefaultAbsMaxCoolSetpointLimit;
+    }
+
+    if (MinCoolSetpointLimit::Get(endpoint, &limits.minCool) != Status::Success)
+        limits.minCool = limits.absMinCool;
+
+    if (MaxCoolSetpointLimit::Get(endpoint, &limits.maxCool) != Status::Success)
+        limits.maxCool = limits.absMaxCool;
+
+    limits.valid = true;
+}
+
+const SetpointLimits & GetSetpointLimits(EndpointId endpoint)
+{
+    uint16_t ep =
+        emberAfGetClusterServerEndpointIndex(endpoint, Thermostat::Id, MATTER_DM_THERMOSTAT_CLUSTER_SERVER_ENDPOINT_COUNT);
+    if (ep >= ArraySize(gSetpointLimits))
+    {
+        // No cache slot for this endpoint, read the limits every time
+        static SetpointLimits sUncachedLimits;
+        LoadSetpointLimits(endpoint, sUncachedLimits);
+        return sUncachedLimits;
+    }
+
+    if (!gSetpointLimits[ep].valid)
+    {
+        LoadSetpointLimits(endpoint, gSetpointLimits[ep]);
     }
+    return gSetpointLimits[ep];
+}
+
+void InvalidateSetpointLimits(EndpointId endpoint)
+{
+    uint16_t ep =
+        emberAfGetClusterServerEndpointIndex(endpoint, Thermostat::Id, MATTER_DM_THERMOSTAT_CLUSTER_SERVER_ENDPOINT_COUNT);
+    if (ep < ArraySize(gSetpointLimits))
+    {
+        gSetpointLimits[ep].valid = false;
+    }
+}
+
+} // namespace
+
+namespace chip {
+namespace app {
+namespace Clusters {
+namespace Thermostat {
+
+ThermostatAttrAccess gThermostatAttrAccess;
+
+int16_t EnforceHeatingSetpointLimits(int16_t HeatingSetpoint, EndpointId endpoint)
+{
+    // The limits are read with their defaults applied, see LoadSetpointLimits
+    const SetpointLimits & Limits = GetSetpointLimits(endpoint);
+
+    int16_t AbsMinHeatSetpointLimit = Limits.absMinHeat;
+    int16_t AbsMaxHeatSetpointLimit = Limits.absMaxHeat;
+    int16_t MinHeatSetpointLimit    = Limits.minHeat;
+    int16_t MaxHeatSetpointLimit    = Limits.maxHeat;
 
     // Make sure the user imposed limits are within the manufacturer imposed limits
 
@@ -151,52 +219,13 @@ int16_t EnforceHeatingSetpointLimits(int16_t HeatingSetpoint, EndpointId endpoin
 
 int16_t EnforceCoolingSetpointLimits(int16_t CoolingSetpoint, EndpointId endpoint)
 {
-    // Optional Mfg supplied limits
-    int16_t AbsMinCoolSetpointLimit = kDefaultAbsMinCoolSetpointLimit;
-    int16_t AbsMaxCoolSetpointLimit = kDefaultAbsMaxCoolSetpointLimit;
-
-    // Optional User supplied limits
-    int16_t MinCoolSetpointLimit = kDefaultMinCoolSetpointLimit;
-    int16_t MaxCoolSetpointLimit = kDefaultMaxCoolSetpointLimit;
-
-    // Attempt to read the setpoint limits
-    // Absmin/max are manufacturer limits
-    // min/max are user imposed min/max
-
-    // Note that the limits are initialized above per the spec limits
-    // if they are not present Get() will not update the value so the defaults are used
-    Status status;
+    // The limits are read with their defaults applied, see LoadSetpointLimits
+    const SetpointLimits & Limits = GetSetpointLimits(endpoint);
 
-    // https://github.com/CHIP-Specifications/connectedhomeip-spec/issues/3724
-    // behavior is not specified when Abs * values are not present and user values are present
-    // implemented behavior accepts the user values without regard to default Abs values.
-
-    // Per global matter data model policy
-    // if a attribute is not present then it's default shall be used.
-
-    status = AbsMinCoolSetpointLimit::Get(endpoint, &AbsMinCoolSetpointLimit);
-    if (status != Status::Success)
-    {
-        ChipLogError(Zcl, "Warning: AbsMinCoolSetpointLimit missing using default");
-    }
-
-    status = AbsMaxCoolSetpointLimit::Get(endpoint, &AbsMaxCoolSetpointLimit);
-    if (status != Status::Success)
-    {
-        ChipLogError(Zcl, "Warning: AbsMaxCoolSetpointLimit missing using default");
-    }
-
-    status = MinCoolSetpointLimit::Get(endpoint, &MinCoolSetpointLimit);
-    if (status != Status::Success)
-    {
-        MinCoolSetpointLimit = AbsMinCoolSetpointLimit;
-    }
-
-    status = MaxCoolSetpointLimit::Get(endpoint, &MaxCoolSetpointLimit);
-    if (status != Status::Success)
-    {
-        MaxCoolSetpointLimit = AbsMaxCoolSetpointLimit;
-    }
+    int16_t AbsMinCoolSetpointLimit = Limits.absMinCool;
+    int16_t AbsMaxCoolSetpointLimit = Limits.absMaxCool;
+    int16_t MinCoolSetpointLimit    = Limits.minCool;
+    int16_t MaxCoolSetpointLimit    = Limits.maxCool;
 
     // Make sure the user imposed limits are within the manufacture imposed limits
     // https://github.com/CHIP-Specifications/connectedhomeip-spec/issues/3725
@@ -304,6 +333,11 @@ CHIP_ERROR ThermostatAttrAccess::Read(const ConcreteReadAttributePath & aPath, A
             return aEncoder.EncodeList([delegate](const auto & encoder) -> CHIP_ERROR {
                 for (uint8_t i = 0; true; i++)
                 {
+                    if (encoder.SkipIfAlreadyEncoded())
+                    {
+                        // Sent in a previous chunk, no need to copy the preset out of the delegate again.
+                        continue;
+                    }
                     PresetStructWithOwnedMembers preset;
                     auto err = delegate->GetPendingPresetAtIndex(i, preset);
                     if (err == CHIP_ERROR_PROVIDER_LIST_EXHAUSTED)
@@ -318,6 +352,11 @@ CHIP_ERROR ThermostatAttrAccess::Read(const ConcreteReadAttributePath & aPath, A
         return aEncoder.EncodeList([delegate](const auto & encoder) -> CHIP_ERROR {
             for (uint8_t i = 0; true; i++)
             {
+                if (encoder.SkipIfAlreadyEncoded())
+                {
+                    // Sent in a previous chunk, no need to copy the preset out of the delegate again.
+                    continue;
+                }
                 PresetStructWithOwnedMembers preset;
                 auto err = delegate->GetPresetAtIndex(i, preset);
                 if (err == CHIP_ERROR_PROVIDER_LIST_EXHAUSTED)
@@ -470,6 +509,24 @@ void ThermostatAttrAccess::OnFabricRemoved(const FabricTable & fabricTable, Fabr
 
 void MatterThermostatClusterServerAttributeChangedCallback(const ConcreteAttributePath & attributePath)
 {
+    switch (attributePath.mAttributeId)
+    {
+    case FeatureMap::Id:
+    case AbsMinHeatSetpointLimit::Id:
+    case AbsMaxHeatSetpointLimit::Id:
+    case MinHeatSetpointLimit::Id:
+    case MaxHeatSetpointLimit::Id:
+    case AbsMinCoolSetpointLimit::Id:
+    case AbsMaxCoolSetpointLimit::Id:
+    case MinCoolSetpointLimit::Id:
+    case MaxCoolSetpointLimit::Id:
+    case MinSetpointDeadBand::Id:
+        InvalidateSetpointLimits(attributePath.mEndpointId);
+        break;
+    default:
+        break;
+    }
+
     uint32_t flags;
     if (FeatureMap::Get(attributePath.mEndpointId, &flags) != Status::Success)
     {
@@ -542,103 +599,42 @@ MatterThermostatClusterServerPreAttributeChangedCallback(const app::ConcreteAttr
     EndpointId endpoint = attributePath.mEndpointId;
     int16_t requested;
 
-    // Limits will be needed for all checks
-    // so we just get them all now
-    int16_t AbsMinHeatSetpointLimit;
-    int16_t AbsMaxHeatSetpointLimit;
-    int16_t MinHeatSetpointLimit;
-    int16_t MaxHeatSetpointLimit;
-    int16_t AbsMinCoolSetpointLimit;
-    int16_t AbsMaxCoolSetpointLimit;
-    int16_t MinCoolSetpointLimit;
-    int16_t MaxCoolSetpointLimit;
-    int8_t DeadBand      = 0;
-    int16_t DeadBandTemp = 0;
+    // Limits will be needed for all checks, they come from the per endpoint snapshot
+    const SetpointLimits & Limits = GetSetpointLimits(endpoint);
+
+    int16_t AbsMinHeatSetpointLimit = Limits.absMinHeat;
+    int16_t AbsMaxHeatSetpointLimit = Limits.absMaxHeat;
+    int16_t MinHeatSetpointLimit    = Limits.minHeat;
+    int16_t MaxHeatSetpointLimit    = Limits.maxHeat;
+    int16_t AbsMinCoolSetpointLimit = Limits.absMinCool;
+    int16_t AbsMaxCoolSetpointLimit = Limits.absMaxCool;
+    int16_t MinCoolSetpointLimit    = Limits.minCool;
+    int16_t MaxCoolSetpointLimit    = Limits.maxCool;
+    int16_t DeadBandTemp            = 0;
+    // The other setpoint of the pair is only read when the deadband has to be checked against it
     int16_t OccupiedCoolingSetpoint;
     int16_t OccupiedHeatingSetpoint;
     int16_t UnoccupiedCoolingSetpoint;
     int16_t UnoccupiedHeatingSetpoint;
-    uint32_t OurFeatureMap;
     bool AutoSupported      = false;
     bool HeatSupported      = false;
     bool CoolSupported      = false;
     bool OccupancySupported = false;
 
-    if (FeatureMap::Get(endpoint, &OurFeatureMap) != Status::Success)
-        OurFeatureMap = FEATURE_MAP_DEFAULT;
-
-    if (OurFeatureMap & 1 << 5) // Bit 5 is Auto Mode supported
+    if (Limits.featureMap & 1 << 5) // Bit 5 is Auto Mode supported
         AutoSupported = true;
 
-    if (OurFeatureMap & 1 << 0)
+    if (Limits.featureMap & 1 << 0)
         HeatSupported = true;
 
-    if (OurFeatureMap & 1 << 1)
+    if (Limits.featureMap & 1 << 1)
         CoolSupported = true;
 
-    if (OurFeatureMap & 1 << 2)
+    if (Limits.featureMap & 1 << 2)
         OccupancySupported = true;
 
     if (AutoSupported)
-    {
-        if (MinSetpointDeadBand::Get(endpoint, &DeadBand) != Status::Success)
-        {
-            DeadBand = kDefaultDeadBand;
-        }
-        DeadBandTemp = static_cast<int16_t>(DeadBand * 10);
-    }
-
-    if (AbsMinCoolSetpointLimit::Get(endpoint, &AbsMinCoolSetpointLimit) != Status::Success)
-        AbsMinCoolSetpointLimit = kDefaultAbsMinCoolSetpointLimit;
-
-    if (AbsMaxCoolSetpointLimit::Get(endpoint, &AbsMaxCoolSetpointLimit) != Status::Success)
-        AbsMaxCoolSetpointLimit = kDefaultAbsMaxCoolSetpointLimit;
-
-    if (MinCoolSetpointLimit::Get(endpoint, &MinCoolSetpointLimit) != Status::Success)
-        MinCoolSetpointLimit = AbsMinCoolSetpointLimit;
-
-    if (MaxCoolSetpointLimit::Get(endpoint, &MaxCoolSetpointLimit) != Status::Success)
-        MaxCoolSetpointLimit = AbsMaxCoolSetpointLimit;
-
-    if (AbsMinHeatSetpointLimit::Get(endpoint, &AbsMinHeatSetpointLimit) != Status::Success)
-        AbsMinHeatSetpointLimit = kDefaultAbsMinHeatSetpointLimit;
-
-    if (AbsMaxHeatSetpointLimit::Get(endpoint, &AbsMaxHeatSetpointLimit) != Status::Success)
-        AbsMaxHeatSetpointLimit = kDefaultAbsMaxHeatSetpointLimit;
-
-    if (MinHeatSetpointLimit::Get(endpoint, &MinHeatSetpointLimit) != Status::Success)
-        MinHeatSetpointLimit = AbsMinHeatSetpointLimit;
-
-    if (MaxHeatSetpointLimit::Get(endpoint, &MaxHeatSetpointLimit) != Status::Success)
-        MaxHeatSetpointLimit = AbsMaxHeatSetpointLimit;
-
-    if (CoolSupported)
-        if (OccupiedCoolingSetpoint::Get(endpoint, &OccupiedCoolingSetpoint) != Status::Success)
-        {
-            ChipLogError(Zcl, "Error: Can not read Occupied Cooling Setpoint");
-            return Status::Failure;
-        }
-
-    if (HeatSupported)
-        if (OccupiedHeatingSetpoint::Get(endpoint, &OccupiedHeatingSetpoint) != Status::Success)
-        {
-            ChipLogError(Zcl, "Error: Can not read Occupied Heating Setpoint");
-            return Status::Failure;
-        }
-
-    if (CoolSupported && OccupancySupported)
-        if (UnoccupiedCoolingSetpoint::Get(endpoint, &UnoccupiedCoolingSetpoint) != Status::Success)
-        {
-            ChipLogError(Zcl, "Error: Can not read Unoccupied Cooling Setpoint");
-            return Status::Failure;
-        }
-
-    if (HeatSupported && OccupancySupported)
-        if (UnoccupiedHeatingSetpoint::Get(endpoint, &UnoccupiedHeatingSetpoint) != Status::Success)
-        {
-            ChipLogError(Zcl, "Error: Can not read Unoccupied Heating Setpoint");
-            return Status::Failure;
-        }
+        DeadBandTemp = static_cast<int16_t>(Limits.deadBand * 10);
 
     switch (attributePath.mAttributeId)
     {
@@ -651,6 +647,11 @@ MatterThermostatClusterServerPreAttributeChangedCallback(const app::ConcreteAttr
             return Status::InvalidValue;
         if (AutoSupported)
         {
+            if (OccupiedCoolingSetpoint::Get(endpoint, &OccupiedCoolingSetpoint) != Status::Success)
+            {
+                ChipLogError(Zcl, "Error: Can not read Occupied Cooling Setpoint");
+                return Status::Failure;
+            }
             if (requested > OccupiedCoolingSetpoint - DeadBandTemp)
                 return Status::InvalidValue;
         }
@@ -666,6 +667,11 @@ MatterThermostatClusterServerPreAttributeChangedCallback(const app::ConcreteAttr
             return Status::InvalidValue;
         if (AutoSupported)
         {
+            if (OccupiedHeatingSetpoint::Get(endpoint, &OccupiedHeatingSetpoint) != Status::Success)
+            {
+                ChipLogError(Zcl, "Error: Can not read Occupied Heating Setpoint");
+                return Status::Failure;
+            }
             if (requested < OccupiedHeatingSetpoint + DeadBandTemp)
                 return Status::InvalidValue;
         }
@@ -681,6 +687,11 @@ MatterThermostatClusterServerPreAttributeChangedCallback(const app::ConcreteAttr
             return Status::InvalidValue;
         if (AutoSupported)
         {
+            if (UnoccupiedCoolingSetpoint::Get(endpoint, &UnoccupiedCoolingSetpoint) != Status::Success)
+            {
+                ChipLogError(Zcl, "Error: Can not read Unoccupied Cooling Setpoint");
+                return Status::Failure;
+            }
             if (requested > UnoccupiedCoolingSetpoint - DeadBandTemp)
                 return Status::InvalidValue;
         }
@@ -695,6 +706,11 @@ MatterThermostatClusterServerPreAttributeChangedCallback(const app::ConcreteAttr
             return Status::InvalidValue;
         if (AutoSupported)
         {
+            if (UnoccupiedHeatingSetpoint::Get(endpoint, &UnoccupiedHeatingSetpoint) != Status::Success)
+            {
+                ChipLogError(Zcl, "Error: Can not read Unoccupied Heating Setpoint");
+                return Status::Failure;
+            }
             if (requested < UnoccupiedHeatingSetpoint + DeadBandTemp)
                 return Status::InvalidValue;
         }
@@ -859,30 +875,22 @@ bool emberAfThermostatClusterSetpointRaiseLowerCallback(app::CommandHandler * co
     Status WriteCoolingSetpointStatus = Status::Failure;
     Status WriteHeatingSetpointStatus = Status::Failure;
     int16_t DeadBandTemp              = 0;
-    int8_t DeadBand                   = 0;
-    uint32_t OurFeatureMap;
-    bool AutoSupported = false;
-    bool HeatSupported = false;
-    bool CoolSupported = false;
-
-    if (FeatureMap::Get(aEndpointId, &OurFeatureMap) != Status::Success)
-        OurFeatureMap = FEATURE_MAP_DEFAULT;
+    const SetpointLimits & Limits     = GetSetpointLimits(aEndpointId);
+    bool AutoSupported                = false;
+    bool HeatSupported                = false;
+    bool CoolSupported                = false;
 
-    if (OurFeatureMap & 1 << 5) // Bit 5 is Auto Mode supported
+    if (Limits.featureMap & 1 << 5) // Bit 5 is Auto Mode supported
         AutoSupported = true;
 
-    if (OurFeatureMap & 1 << 0)
+    if (Limits.featureMap & 1 << 0)
         HeatSupported = true;
 
-    if (OurFeatureMap & 1 << 1)
+    if (Limits.featureMap & 1 << 1)
         CoolSupported = true;
 
     if (AutoSupported)
-    {
-        if (MinSetpointDeadBand::Get(aEndpointId, &DeadBand) != Status::Success)
-            DeadBand = kDefaultDeadBand;
-        DeadBandTemp = static_cast<int16_t>(DeadBand * 10);
-    }
+        DeadBandTemp = static_cast<int16_t>(Limits.deadBand * 10);
 
     switch (mode)
     {
@@ -79,6 +79,7 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+    ClearDirtyClusterGenerations();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -161,6 +162,14 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             if (!apReadHandler->IsPriming())
             {
                 bool concretePathDirty = false;
+                // Nothing in this cluster changed since the last completed report, so skip the rest of its attributes
+                // without expanding them or walking the dirty set.
+                if (!IsClusterDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration))
+                {
+                    apReadHandler->GetAttributePathExpandIterator()->SkipCurrentCluster();
+                    continue;
+                }
+
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
                 mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
                     if (dirtyPath->IsAttributePathSupersetOf(readPath))
@@ -740,6 +749,7 @@ void Engine::Run()
         ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
 
         mGlobalDirtySet.ReleaseAll();
+        ClearDirtyClusterGenerations();
     }
 }
 
@@ -878,12 +888,38 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     return CHIP_NO_ERROR;
 }
 
+uint8_t Engine::GetDirtyClusterBucket(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    static_assert(kDirtyClusterBucketCount == 32, "Bucket index is taken from the top 5 bits of the hash");
+
+    // Fold the vendor prefix of the cluster id in and mix with a multiplicative hash, so that
+    // neighbouring cluster ids on the same endpoint end up in different buckets.
+    uint32_t key = aClusterId ^ (aClusterId >> 16) ^ (static_cast<uint32_t>(aEndpointId) << 16);
+    return static_cast<uint8_t>((key * 2654435761u) >> 27);
+}
+
+uint32_t Engine::GetDirtyClusterBucketMask(const AttributePathParams & aAttributePath)
+{
+    if (aAttributePath.HasWildcardEndpointId() || aAttributePath.HasWildcardClusterId())
+    {
+        return UINT32_MAX;
+    }
+    return static_cast<uint32_t>(1) << GetDirtyClusterBucket(aAttributePath.mEndpointId, aAttributePath.mClusterId);
+}
+
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
-    bool intersectsInterestPath = false;
-    mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+    const uint32_t dirtyBucketMask = GetDirtyClusterBucketMask(aAttributePath);
+    bool intersectsInterestPath    = false;
+    mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        // A handler whose paths do not touch any of the dirty buckets cannot intersect the dirty path.
+        if ((handler->mAttributeInterestBucketMask & dirtyBucketMask) == 0)
+        {
+            return Loop::Continue;
+        }
+
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
         // waiting for a response to the last message chunk for read interactions.
@@ -907,6 +943,14 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
     {
         return CHIP_NO_ERROR;
     }
+
+    for (uint8_t bucket = 0; bucket < kDirtyClusterBucketCount; bucket++)
+    {
+        if (dirtyBucketMask & (static_cast<uint32_t>(1) << bucket))
+        {
+            mDirtyClusterGenerations[bucket] = GetDirtySetGeneration();
+        }
+    }
     ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePath));
 
     return CHIP_NO_ERROR;
@@ -129,6 +129,18 @@ public:
 
     uint64_t GetDirtySetGeneration() const { return mDirtyGeneration; }
 
+    /**
+     * Number of buckets in the dirty cluster filter. Every concrete (endpoint, cluster) pair hashes to one bucket, so the
+     * clusters a ReadHandler is interested in can be summarized in a single 32-bit mask.
+     */
+    static constexpr uint8_t kDirtyClusterBucketCount = 32;
+
+    /**
+     * Returns the dirty cluster filter bucket mask covered by the given path: a single bit for a concrete endpoint and cluster,
+     * every bit when either of them is a wildcard.
+     */
+    static uint32_t GetDirtyClusterBucketMask(const AttributePathParams & aAttributePath);
+
     /**
      * Schedule event delivery to happen immediately and run reporting to get
      * those reports into messages and on the wire.  This can be done either for
@@ -232,6 +244,19 @@ private:
 
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
+    static uint8_t GetDirtyClusterBucket(EndpointId aEndpointId, ClusterId aClusterId);
+
+    /**
+     * Returns whether any path of the given cluster may have been marked dirty after aGeneration. False positives are
+     * possible when clusters share a bucket, false negatives are not.
+     */
+    bool IsClusterDirtySince(const ConcreteClusterPath & aClusterPath, uint64_t aGeneration) const
+    {
+        return mDirtyClusterGenerations[GetDirtyClusterBucket(aClusterPath.mEndpointId, aClusterPath.mClusterId)] > aGeneration;
+    }
+
+    void ClearDirtyClusterGenerations() { memset(mDirtyClusterGenerations, 0, sizeof(mDirtyClusterGenerations)); }
+
     /**
      * Boolean to indicate if ScheduleRun is pending. This flag is used to prevent calling ScheduleRun multiple times
      * within the same execution context to avoid applying too much pressure on platforms that use small, fixed size event queues.
@@ -281,6 +306,13 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+    /**
+     * The latest dirty set generation at which a path hashing to each bucket was marked dirty. Lets report generation skip
+     * the walk over mGlobalDirtySet for clusters that have not changed since a ReadHandler last reported, even after the
+     * dirty set has been merged into wildcard paths.
+     */
+    uint64_t mDirtyClusterGenerations[kDirtyClusterBucketCount] = {};
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
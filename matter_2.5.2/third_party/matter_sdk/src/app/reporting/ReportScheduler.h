@@ -217,6 +217,9 @@ public:
     /// @brief Get the number of ReadHandlers registered in the scheduler's node pool
     size_t GetNumReadHandlers() const { return mNodesPool.Allocated(); }
 
+    /// @brief Get the number of distinct instants at which a report timer woke the scheduler up to schedule an engine run
+    uint32_t GetReportWakeupCount() const { return mReportWakeupCount; }
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     Timestamp GetMinTimestampForHandler(const ReadHandler * aReadHandler)
     {
@@ -252,8 +255,55 @@ protected:
         return foundNode;
     }
 
+    /// @brief Align a report timeout on the CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS grid of the monotonic clock so that timers of
+    /// different handlers expire on the same tick. The expiry is rounded up to the next tick, or down to the previous one if
+    /// rounding up would overshoot aLatest. The timeout is returned unchanged if neither aligned expiry fits in the
+    /// [aEarliest, aLatest] window or if the timeout is 0.
+    /// @param timeout requested timeout
+    /// @param now current time the timeout is relative to
+    /// @param aEarliest earliest timestamp at which the report can be emitted, i.e. the min interval
+    /// @param aLatest latest timestamp at which the report must be emitted, i.e. the max interval
+    System::Clock::Timeout AlignTimeoutToTick(System::Clock::Timeout timeout, const Timestamp & now, const Timestamp & aEarliest,
+                                              const Timestamp & aLatest)
+    {
+#if CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS > 0
+        constexpr Timestamp kTick = System::Clock::Milliseconds64(CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS);
+
+        VerifyOrReturnValue(timeout > System::Clock::Timeout(0), timeout);
+
+        Timestamp target  = now + timeout;
+        Timestamp aligned = Timestamp(((target.count() + kTick.count() - 1) / kTick.count()) * kTick.count());
+        if (aligned > aLatest)
+        {
+            aligned -= kTick;
+        }
+        VerifyOrReturnValue(aligned <= aLatest && aligned >= aEarliest && aligned > now, timeout);
+
+        return std::chrono::duration_cast<System::Clock::Timeout>(aligned - now);
+#else
+        IgnoreUnusedVariable(now);
+        IgnoreUnusedVariable(aEarliest);
+        IgnoreUnusedVariable(aLatest);
+        return timeout;
+#endif // CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS > 0
+    }
+
+    /// @brief Count a report timer wakeup. Timers of several handlers expiring within the same scheduler tick (or the same
+    /// millisecond when quantisation is disabled) are counted as a single wakeup.
+    void CountReportWakeup(const Timestamp & now)
+    {
+        constexpr Timestamp kWakeupWindow = System::Clock::Milliseconds64(
+            (CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS > 0) ? CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS : 1);
+
+        VerifyOrReturn(mReportWakeupCount == 0 || now >= mLastReportWakeup + kWakeupWindow);
+        mLastReportWakeup = now;
+        mReportWakeupCount++;
+    }
+
     ObjectPool<ReadHandlerNode, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mNodesPool;
     TimerDelegate * mTimerDelegate;
+    Timestamp mLastReportWakeup = Timestamp(0);
+    uint32_t mReportWakeupCount = 0;
 };
 }; // namespace reporting
 }; // namespace app
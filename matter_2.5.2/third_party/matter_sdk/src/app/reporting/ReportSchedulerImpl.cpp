@@ -30,6 +30,7 @@ using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
 /// the engine already verifies that read handlers are reportable before sending a report
 void ReportSchedulerImpl::ReportTimerCallback()
 {
+    CountReportWakeup(mTimerDelegate->GetCurrentMonotonicTimestamp());
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
 }
 
@@ -123,6 +124,8 @@ CHIP_ERROR ReportSchedulerImpl::ScheduleReport(Timeout timeout, ReadHandlerNode
         node->TimerFired();
         return CHIP_NO_ERROR;
     }
+    // Align the timer on the scheduler tick so that handlers with overlapping reporting windows wake up together
+    timeout = AlignTimeoutToTick(timeout, now, node->GetMinTimestamp(), node->GetMaxTimestamp());
     ReturnErrorOnFailure(mTimerDelegate->StartTimer(node, timeout));
 
     return CHIP_NO_ERROR;
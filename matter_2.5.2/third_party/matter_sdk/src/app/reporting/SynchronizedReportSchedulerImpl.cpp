@@ -66,6 +66,8 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::ScheduleReport(Timeout timeout, Read
         TimerFired();
         return CHIP_NO_ERROR;
     }
+    // Align the common timer on the scheduler tick, without moving it before the next min or past the next max interval
+    timeout = AlignTimeoutToTick(timeout, now, mNextMinTimestamp, mNextMaxTimestamp);
     ReturnErrorOnFailure(mTimerDelegate->StartTimer(this, timeout));
     mNextReportTimestamp = now + timeout;
 
@@ -179,6 +181,9 @@ void SynchronizedReportSchedulerImpl::TimerFired()
     Timestamp now   = mTimerDelegate->GetCurrentMonotonicTimestamp();
     bool firedEarly = true;
 
+    // Count every expiry of the shared timer, including early ones that only reschedule, as each one wakes the device.
+    CountReportWakeup(now);
+
     // If there are no handlers registered, no need to do anything.
     VerifyOrReturn(mNodesPool.Allocated());
 
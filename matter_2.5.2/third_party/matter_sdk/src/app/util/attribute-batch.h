@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Nullable.h>
+#include <app/util/af-types.h>
+#include <app/util/attribute-storage-null-handling.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/attribute-table.h>
+#include <lib/core/DataModelTypes.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Reads or writes several attributes of one server cluster with a single
+ * endpoint and cluster lookup.
+ *
+ * The caller must hold the Matter stack lock for the whole lifetime of the
+ * batch. Each operation stands on its own: a failed read leaves its value
+ * untouched and the following operations still run. GetStatus() reports the
+ * first failure, so a batch only needs to be checked once. Only a failure to
+ * locate the cluster skips every operation.
+ *
+ * @code
+ *   ClusterAttributeBatch batch(endpoint, Thermostat::Id);
+ *   batch.Read(Thermostat::Attributes::LocalTemperature::Id, localTemperature)
+ *       .Read(Thermostat::Attributes::SystemMode::Id, systemMode);
+ *   VerifyOrReturn(batch.GetStatus() == Protocols::InteractionModel::Status::Success);
+ * @endcode
+ *
+ * Values use the same representation as the generated Accessors. Reads and
+ * writes still go through the regular Ember access checks and attribute
+ * change callbacks.
+ */
+class ClusterAttributeBatch
+{
+public:
+    ClusterAttributeBatch(EndpointId endpoint, ClusterId clusterId)
+    {
+        mLocationStatus = emberAfLocateServerCluster(endpoint, clusterId, mLocation);
+        mStatus         = mLocationStatus;
+    }
+
+    // Status of the first operation that failed, Success if none did
+    Protocols::InteractionModel::Status GetStatus() const { return mStatus; }
+
+    template <typename T>
+    ClusterAttributeBatch & Read(AttributeId attributeId, T & value)
+    {
+        using Traits = NumericAttributeTraits<T>;
+        typename Traits::StorageType temp;
+        VerifyOrReturnValue(ReadStorage(attributeId, Traits::ToAttributeStoreRepresentation(temp), sizeof(temp)), *this);
+        if (!Traits::CanRepresentValue(/* isNullable = */ false, temp))
+        {
+            RecordStatus(Protocols::InteractionModel::Status::ConstraintError);
+            return *this;
+        }
+        value = Traits::StorageToWorking(temp);
+        return *this;
+    }
+
+    template <typename T>
+    ClusterAttributeBatch & Read(AttributeId attributeId, DataModel::Nullable<T> & value)
+    {
+        using Traits = NumericAttributeTraits<T>;
+        typename Traits::StorageType temp;
+        VerifyOrReturnValue(ReadStorage(attributeId, Traits::ToAttributeStoreRepresentation(temp), sizeof(temp)), *this);
+        if (Traits::IsNullValue(temp))
+        {
+            value.SetNull();
+        }
+        else
+        {
+            value.SetNonNull() = Traits::StorageToWorking(temp);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    ClusterAttributeBatch & Write(AttributeId attributeId, T value, EmberAfAttributeType dataType,
+                                  MarkAttributeDirty markDirty = MarkAttributeDirty::kIfChanged)
+    {
+        using Traits = NumericAttributeTraits<T>;
+        VerifyOrReturnValue(mLocationStatus == Protocols::InteractionModel::Status::Success, *this);
+        if (!Traits::CanRepresentValue(/* isNullable = */ true, value))
+        {
+            RecordStatus(Protocols::InteractionModel::Status::ConstraintError);
+            return *this;
+        }
+        typename Traits::StorageType storageValue;
+        Traits::WorkingToStorage(value, storageValue);
+        uint8_t * writable = Traits::ToAttributeStoreRepresentation(storageValue);
+        RecordStatus(
+            emberAfWriteAttribute(mLocation, attributeId, EmberAfWriteDataInput(writable, dataType).SetMarkDirty(markDirty)));
+        return *this;
+    }
+
+private:
+    bool ReadStorage(AttributeId attributeId, uint8_t * buffer, uint16_t size)
+    {
+        VerifyOrReturnValue(mLocationStatus == Protocols::InteractionModel::Status::Success, false);
+        Protocols::InteractionModel::Status status = emberAfReadAttribute(mLocation, attributeId, buffer, size);
+        RecordStatus(status);
+        return status == Protocols::InteractionModel::Status::Success;
+    }
+
+    void RecordStatus(Protocols::InteractionModel::Status status)
+    {
+        if (mStatus == Protocols::InteractionModel::Status::Success)
+        {
+            mStatus = status;
+        }
+    }
+
+    EmberAfClusterLocation mLocation;
+    Protocols::InteractionModel::Status mLocationStatus;
+    Protocols::InteractionModel::Status mStatus;
+};
+
+} // namespace app
+} // namespace chip
@@ -24,6 +24,7 @@
 #include <lib/support/CodeUtils.h>
 
 #include <app/util/attribute-metadata.h>
+#include <app/util/attribute-storage.h>
 #include <zap-generated/endpoint_config.h>
 
 #include <protocols/interaction_model/StatusCode.h>
@@ -36,6 +37,12 @@ chip::Protocols::InteractionModel::Status emAfReadOrWriteAttribute(const EmberAf
                                                                    const EmberAfAttributeMetadata ** metadata, uint8_t * buffer,
                                                                    uint16_t readLength, bool write);
 
+// Same as above for an attribute of an already located cluster, skipping the endpoint and cluster search.
+chip::Protocols::InteractionModel::Status emAfReadOrWriteAttribute(const EmberAfClusterLocation & location,
+                                                                   chip::AttributeId attributeId,
+                                                                   const EmberAfAttributeMetadata ** metadata, uint8_t * buffer,
+                                                                   uint16_t readLength, bool write);
+
 //
 // Given a cluster ID, endpoint ID and a cluster mask, finds a matching cluster within that endpoint
 // with a matching mask. If one is found, the relative index of that cluster within the list of clusters on that
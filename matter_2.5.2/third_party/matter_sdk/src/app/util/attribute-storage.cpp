@@ -26,6 +26,7 @@
 #include <app/reporting/reporting.h>
 #include <app/util/config.h>
 #include <app/util/ember-strings.h>
+#include <app/util/encoded-attribute-cache.h>
 #include <app/util/endpoint-config-api.h>
 #include <app/util/generic-callbacks.h>
 #include <lib/core/CHIPConfig.h>
@@ -66,9 +67,8 @@ uint8_t attributeData[ACTUAL_ATTRIBUTE_SIZE];
 // Loads the attributes from built-in default and storage.
 static void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> = NullOptional);
 
-static bool emAfMatchCluster(const EmberAfCluster * cluster, const EmberAfAttributeSearchRecord * attRecord);
-static bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMetadata * am,
-                               const EmberAfAttributeSearchRecord * attRecord);
+static bool emAfMatchCluster(const EmberAfCluster * cluster, ClusterId clusterId);
+static bool emAfMatchAttribute(const EmberAfAttributeMetadata * am, AttributeId attributeId);
 
 // If server == true, returns the number of server clusters,
 // otherwise number of client clusters on the endpoint at the given index.
@@ -141,6 +141,129 @@ constexpr const EmberAfDeviceType fixedDeviceTypeList[]             = FIXED_DEVI
 DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
 #endif // FIXED_ENDPOINT_COUNT > 0
 
+// Storage offset of every generated attribute inside singletonAttributeData,
+// computed at compile time so singletonAttributeLocation() does not have to
+// walk generatedAttributes. Only meaningful for non-external singletons.
+struct SingletonAttributeOffsets
+{
+    uint16_t offsets[ArraySize(generatedAttributes)];
+};
+
+constexpr SingletonAttributeOffsets ComputeSingletonAttributeOffsets()
+{
+    SingletonAttributeOffsets result{};
+    uint16_t offset = 0;
+    for (size_t i = 0; i < ArraySize(generatedAttributes); i++)
+    {
+        result.offsets[i] = offset;
+        if ((generatedAttributes[i].mask & MATTER_ATTRIBUTE_FLAG_SINGLETON) &&
+            !(generatedAttributes[i].mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+        {
+            offset = static_cast<uint16_t>(offset + generatedAttributes[i].size);
+        }
+    }
+    return result;
+}
+
+constexpr SingletonAttributeOffsets singletonAttributeOffsets = ComputeSingletonAttributeOffsets();
+
+#if FIXED_ENDPOINT_COUNT > 0 && defined(GENERATED_CLUSTERS)
+#define EMBER_AF_GENERATED_CLUSTER_INDEX 1
+
+// Lookup tables for the fixed endpoints, computed at compile time from the
+// generated endpoint configuration. They let emberAfLocateServerCluster()
+// binary search the clusters of a fixed endpoint and get its storage offset
+// directly instead of summing cluster and endpoint sizes on every access.
+struct GeneratedClusterIndex
+{
+    // Indices into generatedClusters, sorted by cluster id within the range
+    // covered by each generated endpoint type.
+    uint16_t sortedClusters[ArraySize(generatedClusters)];
+    // Storage offset of each generated cluster relative to its endpoint.
+    uint16_t clusterOffsets[ArraySize(generatedClusters)];
+    // Storage offset of each fixed endpoint inside attributeData.
+    uint16_t endpointOffsets[FIXED_ENDPOINT_COUNT];
+    // Index of the first generatedClusters entry of each fixed endpoint.
+    uint16_t endpointFirstCluster[FIXED_ENDPOINT_COUNT];
+    // Total storage used by all fixed endpoints; dynamic endpoints start here.
+    uint16_t fixedEndpointsSize;
+};
+
+constexpr GeneratedClusterIndex ComputeGeneratedClusterIndex()
+{
+    constexpr uint8_t fixedEmberAfEndpointTypes[] = FIXED_ENDPOINT_TYPES;
+
+    GeneratedClusterIndex result{};
+    for (const EmberAfEndpointType & endpointType : generatedEmberAfEndpointTypes)
+    {
+        auto first      = static_cast<uint16_t>(endpointType.cluster - generatedClusters);
+        uint16_t offset = 0;
+        for (uint16_t i = 0; i < endpointType.clusterCount; i++)
+        {
+            auto clusterIndex                   = static_cast<uint16_t>(first + i);
+            ClusterId clusterId                 = generatedClusters[clusterIndex].clusterId;
+            result.clusterOffsets[clusterIndex] = offset;
+            offset = static_cast<uint16_t>(offset + generatedClusters[clusterIndex].clusterSize);
+
+            // Insertion sort; endpoint types only have a few dozen clusters.
+            uint16_t j = i;
+            while (j > 0 && generatedClusters[result.sortedClusters[first + j - 1]].clusterId > clusterId)
+            {
+                result.sortedClusters[first + j] = result.sortedClusters[first + j - 1];
+                j--;
+            }
+            result.sortedClusters[first + j] = clusterIndex;
+        }
+    }
+
+    uint16_t offset = 0;
+    for (uint16_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    {
+        const EmberAfEndpointType & endpointType = generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
+        result.endpointOffsets[ep]               = offset;
+        result.endpointFirstCluster[ep]          = static_cast<uint16_t>(endpointType.cluster - generatedClusters);
+        offset                                   = static_cast<uint16_t>(offset + endpointType.endpointSize);
+    }
+    result.fixedEndpointsSize = offset;
+    return result;
+}
+
+constexpr GeneratedClusterIndex generatedClusterIndex = ComputeGeneratedClusterIndex();
+
+// Binary search for a server cluster of fixed endpoint index ep.
+const EmberAfCluster * findFixedServerCluster(uint16_t ep, ClusterId clusterId, uint16_t & storageOffset)
+{
+    const uint16_t * sorted = &generatedClusterIndex.sortedClusters[generatedClusterIndex.endpointFirstCluster[ep]];
+    uint16_t low            = 0;
+    uint16_t high           = emAfEndpoints[ep].endpointType->clusterCount;
+    while (low < high)
+    {
+        uint16_t mid = static_cast<uint16_t>(low + (high - low) / 2);
+        if (generatedClusters[sorted[mid]].clusterId < clusterId)
+        {
+            low = static_cast<uint16_t>(mid + 1);
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    // The client and server instances of a cluster share its id.
+    for (; low < emAfEndpoints[ep].endpointType->clusterCount && generatedClusters[sorted[low]].clusterId == clusterId; low++)
+    {
+        const EmberAfCluster * cluster = &generatedClusters[sorted[low]];
+        if (cluster->IsServer())
+        {
+            storageOffset = static_cast<uint16_t>(generatedClusterIndex.endpointOffsets[ep] +
+                                                  generatedClusterIndex.clusterOffsets[sorted[low]]);
+            return cluster;
+        }
+    }
+    return nullptr;
+}
+#endif // FIXED_ENDPOINT_COUNT > 0 && defined(GENERATED_CLUSTERS)
+
 bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
 {
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
@@ -456,17 +579,14 @@ const EmberAfAttributeMetadata * emberAfLocateAttributeMetadata(EndpointId endpo
 
 static uint8_t * singletonAttributeLocation(const EmberAfAttributeMetadata * am)
 {
-    const EmberAfAttributeMetadata * m = &(generatedAttributes[0]);
-    uint16_t index                     = 0;
-    while (m < am)
+    // Singleton storage only exists for the generated configuration; attributes
+    // of dynamic endpoints are always accessed externally.
+    auto index = static_cast<size_t>(am - &(generatedAttributes[0]));
+    if (index >= ArraySize(generatedAttributes))
     {
-        if (m->IsSingleton() && !m->IsExternal())
-        {
-            index = static_cast<uint16_t>(index + m->size);
-        }
-        m++;
+        return singletonAttributeData;
     }
-    return (uint8_t *) (singletonAttributeData + index);
+    return (uint8_t *) (singletonAttributeData + singletonAttributeOffsets.offsets[index]);
 }
 
 // This function does mem copy, but smartly, which means that if the type is a
@@ -531,28 +651,92 @@ static Status typeSensitiveMemCopy(ClusterId clusterId, uint8_t * dest, uint8_t
  * @brief Matches a cluster based on cluster id and direction.
  *
  *   This function assumes that the passed cluster's endpoint already
- *   matches the endpoint of the EmberAfAttributeSearchRecord.
+ *   matches the endpoint being searched.
  *
  * Clusters match if:
  *   1. Cluster ids match AND
  *   2. Cluster is a server cluster (because there are no client attributes).
  */
-bool emAfMatchCluster(const EmberAfCluster * cluster, const EmberAfAttributeSearchRecord * attRecord)
+bool emAfMatchCluster(const EmberAfCluster * cluster, ClusterId clusterId)
 {
-    return (cluster->clusterId == attRecord->clusterId && (cluster->mask & MATTER_CLUSTER_FLAG_SERVER));
+    return (cluster->clusterId == clusterId && (cluster->mask & MATTER_CLUSTER_FLAG_SERVER));
 }
 
 /**
  * @brief Matches an attribute based on attribute id.
- *   This function assumes that the passed cluster already matches the
- *   clusterId and direction of the passed EmberAfAttributeSearchRecord.
+ *   This function assumes that the attribute belongs to the cluster
+ *   being searched.
  *
  * Attributes match if attr ids match.
  */
-bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMetadata * am,
-                        const EmberAfAttributeSearchRecord * attRecord)
+bool emAfMatchAttribute(const EmberAfAttributeMetadata * am, AttributeId attributeId)
+{
+    return (am->attributeId == attributeId);
+}
+
+// Linear search for a server cluster in an endpoint type, adding the storage
+// size of the clusters that precede it to storageOffset.
+static const EmberAfCluster * findServerClusterInType(const EmberAfEndpointType * endpointType, ClusterId clusterId,
+                                                      uint16_t & storageOffset)
+{
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, clusterId))
+        {
+            return cluster;
+        }
+
+        // Not the cluster we are looking for
+        storageOffset = static_cast<uint16_t>(storageOffset + cluster->clusterSize);
+    }
+    return nullptr;
+}
+
+Status emberAfLocateServerCluster(EndpointId endpoint, ClusterId clusterId, EmberAfClusterLocation & location)
 {
-    return (am->attributeId == attRecord->attributeId);
+    assertChipStackLockedByCurrentThread();
+
+    uint16_t ep = findIndexFromEndpoint(endpoint, true /* ignoreDisabledEndpoints */);
+    if (ep == kEmberInvalidEndpointIndex)
+    {
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
+
+    // Dynamic endpoints are external and don't factor into storage size
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+    const EmberAfCluster * cluster;
+    uint16_t attributeOffsetIndex = 0;
+
+#ifdef EMBER_AF_GENERATED_CLUSTER_INDEX
+    if (!isDynamicEndpoint)
+    {
+        cluster = findFixedServerCluster(ep, clusterId, attributeOffsetIndex);
+    }
+    else
+    {
+        attributeOffsetIndex = generatedClusterIndex.fixedEndpointsSize;
+        cluster              = findServerClusterInType(emAfEndpoints[ep].endpointType, clusterId, attributeOffsetIndex);
+    }
+#else
+    for (uint16_t i = 0; i < ep && i < emberAfFixedEndpointCount(); i++)
+    {
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
+    }
+    cluster = findServerClusterInType(emAfEndpoints[ep].endpointType, clusterId, attributeOffsetIndex);
+#endif // EMBER_AF_GENERATED_CLUSTER_INDEX
+
+    if (cluster == nullptr)
+    {
+        // Cluster is not in the endpoint.
+        return Status::UnsupportedCluster;
+    }
+
+    location.endpoint          = endpoint;
+    location.cluster           = cluster;
+    location.storageOffset     = attributeOffsetIndex;
+    location.isDynamicEndpoint = isDynamicEndpoint;
+    return Status::Success;
 }
 
 // When reading non-string attributes, this function returns an error when destination
@@ -570,121 +754,99 @@ bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMe
 // byte(s) in the resulting string will reflect any truncated.
 Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeMetadata ** metadata,
                                 uint8_t * buffer, uint16_t readLength, bool write)
+{
+    EmberAfClusterLocation location;
+    Status status = emberAfLocateServerCluster(attRecord->endpoint, attRecord->clusterId, location);
+    if (status != Status::Success)
+    {
+        return status;
+    }
+
+    return emAfReadOrWriteAttribute(location, attRecord->attributeId, metadata, buffer, readLength, write);
+}
+
+Status emAfReadOrWriteAttribute(const EmberAfClusterLocation & location, AttributeId attributeId,
+                                const EmberAfAttributeMetadata ** metadata, uint8_t * buffer, uint16_t readLength, bool write)
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
+    const EmberAfCluster * cluster = location.cluster;
+    ClusterId clusterId            = cluster->clusterId;
+    uint16_t attributeOffsetIndex  = location.storageOffset;
 
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+        if (emAfMatchAttribute(am, attributeId))
+        { // Got the attribute
+            // If passed metadata location is not null, populate
+            if (metadata != nullptr)
+            {
+                *metadata = am;
+            }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
+            uint8_t * attributeLocation = (am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON ? singletonAttributeLocation(am)
+                                                                                       : attributeData + attributeOffsetIndex);
+            uint8_t *src, *dst;
+            if (write)
             {
-                continue;
+                src = buffer;
+                dst = attributeLocation;
+                if (!emberAfAttributeWriteAccessCallback(location.endpoint, clusterId, am->attributeId))
+                {
+                    return Status::UnsupportedAccess;
+                }
             }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+            else
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON ? singletonAttributeLocation(am)
-                                                                                : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return Status::Success;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                                {
-                                    return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                          am, buffer)
-                                                  : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                         am, buffer, emberAfAttributeSize(am)));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return Status::Failure;
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE) &&
-                                !(am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
+                if (buffer == nullptr)
+                {
+                    return Status::Success;
+                }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
+                src = attributeLocation;
+                dst = buffer;
+                if (!emberAfAttributeReadAccessCallback(location.endpoint, clusterId, am->attributeId))
+                {
+                    return Status::UnsupportedAccess;
                 }
+            }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+            // Is the attribute externally stored?
+            if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+            {
+                return (write ? emberAfExternalAttributeWriteCallback(location.endpoint, clusterId, am, buffer)
+                              : emberAfExternalAttributeReadCallback(location.endpoint, clusterId, am, buffer,
+                                                                     emberAfAttributeSize(am)));
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+            // Internal storage is only supported for fixed endpoints
+            if (!location.isDynamicEndpoint)
+            {
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+                if (write)
+                {
+                    // Writes that do not mark the attribute dirty keep the data version, so drop any cached encoding.
+                    Compatibility::GetEncodedAttributeCache().Invalidate(
+                        ConcreteAttributePath(location.endpoint, clusterId, am->attributeId));
+                }
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+                return typeSensitiveMemCopy(clusterId, dst, src, am, write, readLength);
+            }
+
+            return Status::Failure;
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
+        // Not the attribute we are looking for
+        // Increase the index if attribute is not externally stored
+        if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE) && !(am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON))
         {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
         }
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Attribute is not in the cluster.
+    return Status::UnsupportedAttribute;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -22,6 +22,7 @@
 #include <app/util/config.h>
 #include <app/util/endpoint-config-defines.h>
 #include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
 
 #include <app-common/zap-generated/attribute-type.h>
 #include <app-common/zap-generated/cluster-objects.h>
@@ -85,6 +86,34 @@ static constexpr uint16_t kEmberInvalidEndpointIndex = 0xFFFF;
 const EmberAfAttributeMetadata * emberAfLocateAttributeMetadata(chip::EndpointId endpoint, chip::ClusterId clusterId,
                                                                 chip::AttributeId attributeId);
 
+/**
+ * Location of a server cluster in the attribute store.
+ *
+ * Resolving it once lets several attributes of the same cluster be read or
+ * written without searching the endpoint and cluster tables again. It is only
+ * valid while the Matter stack lock is held and the endpoint configuration
+ * does not change.
+ */
+struct EmberAfClusterLocation
+{
+    chip::EndpointId endpoint      = chip::kInvalidEndpointId;
+    const EmberAfCluster * cluster = nullptr;
+    uint16_t storageOffset         = 0; // Offset of the cluster storage in attributeData
+    bool isDynamicEndpoint         = false;
+};
+
+/**
+ * @brief locate a server cluster
+ *
+ * @param endpoint Zigbee endpoint number.
+ * @param clusterId Cluster ID of the sought server cluster.
+ * @param location Populated with the cluster location on success.
+ *
+ * @return Status::Success, Status::UnsupportedEndpoint or Status::UnsupportedCluster.
+ */
+chip::Protocols::InteractionModel::Status emberAfLocateServerCluster(chip::EndpointId endpoint, chip::ClusterId clusterId,
+                                                                     EmberAfClusterLocation & location);
+
 /**
  * @brief Returns true if endpoint contains the ZCL server with specified id.
  *
@@ -162,6 +162,12 @@ int8_t emberAfCompareValues(const uint8_t * val1, const uint8_t * val2, uint16_t
 Status emAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWriteDataInput & input,
                           bool overrideReadOnlyAndDataType);
 
+/**
+ * Same as above for an attribute of an already located cluster.
+ */
+Status emAfWriteAttribute(const EmberAfClusterLocation & location, AttributeId attributeId, const EmberAfWriteDataInput & input,
+                          bool overrideReadOnlyAndDataType);
+
 } // anonymous namespace
 
 Protocols::InteractionModel::Status emAfWriteAttributeExternal(const ConcreteAttributePath & path,
@@ -198,6 +204,18 @@ Status emberAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWr
     return emAfWriteAttribute(path, completeInput, true /* overrideReadOnlyAndDataType */);
 }
 
+Status emberAfWriteAttribute(const EmberAfClusterLocation & location, AttributeId attributeID, const EmberAfWriteDataInput & input)
+{
+    EmberAfWriteDataInput completeInput = input;
+
+    if (completeInput.changeListener == nullptr)
+    {
+        completeInput.SetChangeListener(emberAfGlobalInteractionModelAttributesChangedListener());
+    }
+
+    return emAfWriteAttribute(location, attributeID, completeInput, true /* overrideReadOnlyAndDataType */);
+}
+
 //------------------------------------------------------------------------------
 // Internal Functions
 
@@ -264,7 +282,7 @@ namespace {
  * attribute is changing.  On success, the isChanging outparam will be set to
  * whether the value is changing.
  */
-Status AttributeValueIsChanging(EndpointId endpoint, ClusterId cluster, AttributeId attributeID,
+Status AttributeValueIsChanging(const EmberAfClusterLocation & location, AttributeId attributeID,
                                 const EmberAfAttributeMetadata * metadata, uint8_t * newValueData, bool * isChanging)
 {
     EmberAfAttributeType attributeType = metadata->attributeType;
@@ -290,7 +308,7 @@ Status AttributeValueIsChanging(EndpointId endpoint, ClusterId cluster, Attribut
 
     uint8_t oldValueBuffer[kMaxValueSize];
     // Cast to uint16_t is safe, because we checked valueSize <= kMaxValueSize above.
-    if (emberAfReadAttribute(endpoint, cluster, attributeID, oldValueBuffer, static_cast<uint16_t>(valueSize)) != Status::Success)
+    if (emberAfReadAttribute(location, attributeID, oldValueBuffer, static_cast<uint16_t>(valueSize)) != Status::Success)
     {
         // We failed to read the old value, so flag the value as changing to be safe.
         *isChanging = true;
@@ -329,15 +347,29 @@ Status AttributeValueIsChanging(EndpointId endpoint, ClusterId cluster, Attribut
 
 Status emAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWriteDataInput & input, bool overrideReadOnlyAndDataType)
 {
+    // Locate the cluster once, the metadata lookup, the old value read and the write below all reuse it.
+    EmberAfClusterLocation location;
+    Status status = emberAfLocateServerCluster(path.mEndpointId, path.mClusterId, location);
+    if (status != Status::Success)
+    {
+        ChipLogProgress(Zcl, "%p ep %x clus " ChipLogFormatMEI " attr " ChipLogFormatMEI " not supported",
+                        "WRITE ERR: ", path.mEndpointId, ChipLogValueMEI(path.mClusterId), ChipLogValueMEI(path.mAttributeId));
+        return status;
+    }
+
+    return emAfWriteAttribute(location, path.mAttributeId, input, overrideReadOnlyAndDataType);
+}
+
+Status emAfWriteAttribute(const EmberAfClusterLocation & location, AttributeId attributeId, const EmberAfWriteDataInput & input,
+                          bool overrideReadOnlyAndDataType)
+{
+    const ConcreteAttributePath path(location.endpoint, location.cluster->clusterId, attributeId);
+
     const EmberAfAttributeMetadata * metadata = nullptr;
-    EmberAfAttributeSearchRecord record;
-    record.endpoint    = path.mEndpointId;
-    record.clusterId   = path.mClusterId;
-    record.attributeId = path.mAttributeId;
-    Status status      = emAfReadOrWriteAttribute(&record, &metadata,
-                                                  nullptr, // buffer
-                                                  0,       // buffer size
-                                                  false);  // write?
+    Status status                             = emAfReadOrWriteAttribute(location, attributeId, &metadata,
+                                                                         nullptr, // buffer
+                                                                         0,       // buffer size
+                                                                         false);  // write?
 
     // if we dont support that attribute
     if (metadata == nullptr)
@@ -407,8 +439,7 @@ Status emAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWrite
 
     // Check whether anything is actually changing, before we do any work here.
     bool valueChanging;
-    Status imStatus =
-        AttributeValueIsChanging(path.mEndpointId, path.mClusterId, path.mAttributeId, metadata, input.dataPtr, &valueChanging);
+    Status imStatus = AttributeValueIsChanging(location, path.mAttributeId, metadata, input.dataPtr, &valueChanging);
     if (imStatus != Status::Success)
     {
         return imStatus;
@@ -451,7 +482,7 @@ Status emAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWrite
     }
 
     // write the attribute
-    status = emAfReadOrWriteAttribute(&record,
+    status = emAfReadOrWriteAttribute(location, attributeId,
                                       nullptr, // metadata
                                       input.dataPtr,
                                       0,     // buffer size - unused
@@ -503,3 +534,18 @@ Status emberAfReadAttribute(EndpointId endpoint, ClusterId cluster, AttributeId
 
     return status;
 }
+
+Status emberAfReadAttribute(const EmberAfClusterLocation & location, AttributeId attributeID, uint8_t * dataPtr,
+                            uint16_t readLength)
+{
+    Status status = emAfReadOrWriteAttribute(location, attributeID, nullptr, dataPtr, readLength,
+                                             false); // write?
+
+    // failed, print debug info
+    if (status == Status::ResourceExhausted)
+    {
+        ChipLogProgress(Zcl, "READ: attribute size too large for caller");
+    }
+
+    return status;
+}
@@ -20,6 +20,7 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/util/af-types.h>
 #include <app/util/attribute-metadata.h>
+#include <app/util/attribute-storage.h>
 #include <lib/core/DataModelTypes.h>
 #include <protocols/interaction_model/StatusCode.h>
 
@@ -112,3 +113,23 @@ chip::Protocols::InteractionModel::Status emberAfWriteAttribute(chip::EndpointId
 chip::Protocols::InteractionModel::Status emberAfReadAttribute(chip::EndpointId endpoint, chip::ClusterId cluster,
                                                                chip::AttributeId attributeID, uint8_t * dataPtr,
                                                                uint16_t readLength);
+
+/**
+ * @brief write an attribute of an already located cluster.
+ *
+ * Same as emberAfWriteAttribute above without the endpoint and cluster
+ * search, see emberAfLocateServerCluster. Useful when writing several
+ * attributes of the same cluster in a row.
+ */
+chip::Protocols::InteractionModel::Status emberAfWriteAttribute(const EmberAfClusterLocation & location,
+                                                                chip::AttributeId attributeID, const EmberAfWriteDataInput & input);
+
+/**
+ * @brief Read an attribute of an already located cluster.
+ *
+ * Same as emberAfReadAttribute above without the endpoint and cluster
+ * search, see emberAfLocateServerCluster.
+ */
+chip::Protocols::InteractionModel::Status emberAfReadAttribute(const EmberAfClusterLocation & location,
+                                                               chip::AttributeId attributeID, uint8_t * dataPtr,
+                                                               uint16_t readLength);
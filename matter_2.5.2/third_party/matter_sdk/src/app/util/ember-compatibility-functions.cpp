@@ -35,6 +35,7 @@
 #include <app/util/config.h>
 #include <app/util/ember-global-attribute-access-interface.h>
 #include <app/util/ember-io-storage.h>
+#include <app/util/encoded-attribute-cache.h>
 #include <app/util/odd-sized-integers.h>
 #include <app/util/util.h>
 #include <lib/core/CHIPCore.h>
@@ -255,103 +256,14 @@ void FindAttributeMetadata(const ConcreteAttributePath & aPath, const EmberAfClu
     *aAttributeMetadata = emberAfLocateAttributeMetadata(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
 }
 
-} // anonymous namespace
-
-bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath)
-{
-    for (auto & attr : GlobalAttributesNotInMetadata)
-    {
-        if (attr == aPath.mAttributeId)
-        {
-            return (emberAfFindServerCluster(aPath.mEndpointId, aPath.mClusterId) != nullptr);
-        }
-    }
-    return (emberAfLocateAttributeMetadata(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId) != nullptr);
-}
-
-CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
-                                 const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
-                                 AttributeEncodeState * apEncoderState)
+// Encodes the value of an Ember attribute, already read into gEmberAttributeIOBufferSpan, into attributeReport.
+CHIP_ERROR EncodeEmberAttributeReport(AttributeReportIB::Builder & attributeReport, const ConcreteReadAttributePath & aPath,
+                                      DataVersion aDataVersion, const EmberAfAttributeMetadata * attributeMetadata)
 {
-    ChipLogDetail(DataManagement,
-                  "Reading attribute: Cluster=" ChipLogFormatMEI " Endpoint=%x AttributeId=" ChipLogFormatMEI " (expanded=%d)",
-                  ChipLogValueMEI(aPath.mClusterId), aPath.mEndpointId, ChipLogValueMEI(aPath.mAttributeId), aPath.mExpanded);
-
-    // Check attribute existence. This includes attributes with registered metadata, but also specially handled
-    // mandatory global attributes (which just check for cluster on endpoint).
-
-    const EmberAfCluster * attributeCluster            = nullptr;
-    const EmberAfAttributeMetadata * attributeMetadata = nullptr;
-    FindAttributeMetadata(aPath, &attributeCluster, &attributeMetadata);
-
-    if (attributeCluster == nullptr && attributeMetadata == nullptr)
-    {
-        return CHIP_ERROR_IM_GLOBAL_STATUS_VALUE(UnsupportedAttributeStatus(aPath));
-    }
-
-    // Check access control. A failed check will disallow the operation, and may or may not generate an attribute report
-    // depending on whether the path was expanded.
-
-    {
-        Access::RequestPath requestPath{ .cluster     = aPath.mClusterId,
-                                         .endpoint    = aPath.mEndpointId,
-                                         .requestType = Access::RequestType::kAttributeReadRequest,
-                                         .entityId    = aPath.mAttributeId };
-        Access::Privilege requestPrivilege = RequiredPrivilege::ForReadAttribute(aPath);
-        CHIP_ERROR err                     = Access::GetAccessControl().Check(aSubjectDescriptor, requestPath, requestPrivilege);
-        if (err != CHIP_NO_ERROR)
-        {
-            ReturnErrorCodeIf((err != CHIP_ERROR_ACCESS_DENIED) && (err != CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL), err);
-            if (aPath.mExpanded)
-            {
-                return CHIP_NO_ERROR;
-            }
-            return err == CHIP_ERROR_ACCESS_DENIED ? CHIP_IM_GLOBAL_STATUS(UnsupportedAccess)
-                                                   : CHIP_IM_GLOBAL_STATUS(AccessRestricted);
-        }
-    }
-
-    {
-        // Special handling for mandatory global attributes: these are always for attribute list, using a special
-        // reader (which can be lightweight constructed even from nullptr).
-        GlobalAttributeReader reader(attributeCluster);
-        AttributeAccessInterface * attributeOverride = (attributeCluster != nullptr)
-            ? &reader
-            : AttributeAccessInterfaceRegistry::Instance().Get(aPath.mEndpointId, aPath.mClusterId);
-        if (attributeOverride)
-        {
-            bool triedEncode = false;
-            ReturnErrorOnFailure(ReadViaAccessInterface(aSubjectDescriptor, aIsFabricFiltered, aPath, aAttributeReports,
-                                                        apEncoderState, attributeOverride, &triedEncode));
-            ReturnErrorCodeIf(triedEncode, CHIP_NO_ERROR);
-        }
-    }
-
-    // Read attribute using Ember, if it doesn't have an override.
-
-    EmberAfAttributeSearchRecord record;
-    record.endpoint    = aPath.mEndpointId;
-    record.clusterId   = aPath.mClusterId;
-    record.attributeId = aPath.mAttributeId;
-    Status status      = emAfReadOrWriteAttribute(&record, &attributeMetadata, gEmberAttributeIOBufferSpan.data(),
-                                                  static_cast<uint16_t>(gEmberAttributeIOBufferSpan.size()),
-                                                  /* write = */ false);
-
-    if (status != Status::Success)
-    {
-        return CHIP_ERROR_IM_GLOBAL_STATUS_VALUE(status);
-    }
-
-    // data available, return the corresponding record
-    AttributeReportIB::Builder & attributeReport = aAttributeReports.CreateAttributeReport();
-    ReturnErrorOnFailure(aAttributeReports.GetError());
-
     AttributeDataIB::Builder & attributeDataIBBuilder = attributeReport.CreateAttributeData();
     ReturnErrorOnFailure(attributeDataIBBuilder.GetError());
 
-    DataVersion version = 0;
-    ReturnErrorOnFailure(ReadClusterDataVersion(aPath, version));
-    attributeDataIBBuilder.DataVersion(version);
+    attributeDataIBBuilder.DataVersion(aDataVersion);
     ReturnErrorOnFailure(attributeDataIBBuilder.GetError());
 
     AttributePathIB::Builder & attributePathIBBuilder = attributeDataIBBuilder.CreatePath();
@@ -528,6 +440,181 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, b
     return attributeReport.EndOfAttributeReportIB();
 }
 
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+// Largest encoding of the AttributeReportIB members around an Ember value: the AttributeDataIB container, a 32 bit data
+// version, a path with 32 bit ids and the data element header with a 2 byte string length.
+constexpr size_t kEmberAttributeReportOverhead = 32;
+
+// Upper bound of the encoded size of an Ember attribute report, for the value already read into gEmberAttributeIOBufferSpan.
+size_t EmberAttributeReportSizeBound(const EmberAfAttributeMetadata * attributeMetadata)
+{
+    size_t valueSize;
+    switch (AttributeBaseType(attributeMetadata->attributeType))
+    {
+    case ZCL_CHAR_STRING_ATTRIBUTE_TYPE:
+    case ZCL_OCTET_STRING_ATTRIBUTE_TYPE:
+        valueSize = (gEmberAttributeIOBufferSpan[0] == 0xFF) ? 0 : gEmberAttributeIOBufferSpan[0];
+        break;
+    case ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE:
+    case ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE: {
+        uint16_t dataLength;
+        memcpy(&dataLength, gEmberAttributeIOBufferSpan.data(), sizeof(dataLength));
+        valueSize = (dataLength == 0xFFFF) ? 0 : dataLength;
+        break;
+    }
+    default:
+        // Every other supported type, odd sized integers included, is encoded in at most 8 bytes
+        valueSize = sizeof(uint64_t);
+        break;
+    }
+    return kEmberAttributeReportOverhead + valueSize;
+}
+
+// Encodes an Ember attribute report into a scratch buffer and caches the AttributeReportIB members. Returns the cached
+// members, or an empty span if the report is too large to be cached.
+ByteSpan EncodeAndCacheEmberAttributeReport(const ConcreteReadAttributePath & aPath, DataVersion aDataVersion,
+                                            const EmberAfAttributeMetadata * attributeMetadata)
+{
+    // Room for the structure control byte and end of container on top of the cached members.
+    uint8_t buffer[Compatibility::EncodedAttributeCache::kMaxEntrySize + 2];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+
+    AttributeReportIB::Builder attributeReport;
+    VerifyOrReturnValue(attributeReport.Init(&writer) == CHIP_NO_ERROR, ByteSpan());
+    VerifyOrReturnValue(EncodeEmberAttributeReport(attributeReport, aPath, aDataVersion, attributeMetadata) == CHIP_NO_ERROR,
+                        ByteSpan());
+    VerifyOrReturnValue(writer.Finalize() == CHIP_NO_ERROR, ByteSpan());
+
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    reader.Init(buffer, writer.GetLengthWritten());
+    VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR && reader.EnterContainer(outerType) == CHIP_NO_ERROR, ByteSpan());
+    const uint8_t * members = reader.GetReadPoint();
+    VerifyOrReturnValue(reader.ExitContainer(outerType) == CHIP_NO_ERROR, ByteSpan());
+
+    ByteSpan encoded(members, static_cast<size_t>(reader.GetReadPoint() - members));
+    return Compatibility::GetEncodedAttributeCache().Store(aPath, aDataVersion, encoded);
+}
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+} // anonymous namespace
+
+bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath)
+{
+    for (auto & attr : GlobalAttributesNotInMetadata)
+    {
+        if (attr == aPath.mAttributeId)
+        {
+            return (emberAfFindServerCluster(aPath.mEndpointId, aPath.mClusterId) != nullptr);
+        }
+    }
+    return (emberAfLocateAttributeMetadata(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId) != nullptr);
+}
+
+CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                 const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
+                                 AttributeEncodeState * apEncoderState)
+{
+    ChipLogDetail(DataManagement,
+                  "Reading attribute: Cluster=" ChipLogFormatMEI " Endpoint=%x AttributeId=" ChipLogFormatMEI " (expanded=%d)",
+                  ChipLogValueMEI(aPath.mClusterId), aPath.mEndpointId, ChipLogValueMEI(aPath.mAttributeId), aPath.mExpanded);
+
+    // Check attribute existence. This includes attributes with registered metadata, but also specially handled
+    // mandatory global attributes (which just check for cluster on endpoint).
+
+    const EmberAfCluster * attributeCluster            = nullptr;
+    const EmberAfAttributeMetadata * attributeMetadata = nullptr;
+    FindAttributeMetadata(aPath, &attributeCluster, &attributeMetadata);
+
+    if (attributeCluster == nullptr && attributeMetadata == nullptr)
+    {
+        return CHIP_ERROR_IM_GLOBAL_STATUS_VALUE(UnsupportedAttributeStatus(aPath));
+    }
+
+    // Check access control. A failed check will disallow the operation, and may or may not generate an attribute report
+    // depending on whether the path was expanded.
+
+    {
+        Access::RequestPath requestPath{ .cluster     = aPath.mClusterId,
+                                         .endpoint    = aPath.mEndpointId,
+                                         .requestType = Access::RequestType::kAttributeReadRequest,
+                                         .entityId    = aPath.mAttributeId };
+        Access::Privilege requestPrivilege = RequiredPrivilege::ForReadAttribute(aPath);
+        CHIP_ERROR err                     = Access::GetAccessControl().Check(aSubjectDescriptor, requestPath, requestPrivilege);
+        if (err != CHIP_NO_ERROR)
+        {
+            ReturnErrorCodeIf((err != CHIP_ERROR_ACCESS_DENIED) && (err != CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL), err);
+            if (aPath.mExpanded)
+            {
+                return CHIP_NO_ERROR;
+            }
+            return err == CHIP_ERROR_ACCESS_DENIED ? CHIP_IM_GLOBAL_STATUS(UnsupportedAccess)
+                                                   : CHIP_IM_GLOBAL_STATUS(AccessRestricted);
+        }
+    }
+
+    {
+        // Special handling for mandatory global attributes: these are always for attribute list, using a special
+        // reader (which can be lightweight constructed even from nullptr).
+        GlobalAttributeReader reader(attributeCluster);
+        AttributeAccessInterface * attributeOverride = (attributeCluster != nullptr)
+            ? &reader
+            : AttributeAccessInterfaceRegistry::Instance().Get(aPath.mEndpointId, aPath.mClusterId);
+        if (attributeOverride)
+        {
+            bool triedEncode = false;
+            ReturnErrorOnFailure(ReadViaAccessInterface(aSubjectDescriptor, aIsFabricFiltered, aPath, aAttributeReports,
+                                                        apEncoderState, attributeOverride, &triedEncode));
+            ReturnErrorCodeIf(triedEncode, CHIP_NO_ERROR);
+        }
+    }
+
+    // Read attribute using Ember, if it doesn't have an override.
+
+    EmberAfAttributeSearchRecord record;
+    record.endpoint    = aPath.mEndpointId;
+    record.clusterId   = aPath.mClusterId;
+    record.attributeId = aPath.mAttributeId;
+    Status status      = emAfReadOrWriteAttribute(&record, &attributeMetadata, gEmberAttributeIOBufferSpan.data(),
+                                                  static_cast<uint16_t>(gEmberAttributeIOBufferSpan.size()),
+                                                  /* write = */ false);
+
+    if (status != Status::Success)
+    {
+        return CHIP_ERROR_IM_GLOBAL_STATUS_VALUE(status);
+    }
+
+    DataVersion version = 0;
+    ReturnErrorOnFailure(ReadClusterDataVersion(aPath, version));
+
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+    // Once access control has passed, a plain Ember attribute encodes the same way for every subscriber, so share the
+    // encoding between all the reports of one change. External attributes are read through callbacks that may change the
+    // value without bumping the data version, so they are always encoded directly. Values too large for a cache entry are
+    // recognised before encoding, so that they are only encoded once, straight into the report.
+    if (!attributeMetadata->IsExternal() && emberAfIndexFromEndpoint(aPath.mEndpointId) < emberAfFixedEndpointCount() &&
+        EmberAttributeReportSizeBound(attributeMetadata) <= Compatibility::EncodedAttributeCache::kMaxEntrySize)
+    {
+        ByteSpan encoded;
+        if (!Compatibility::GetEncodedAttributeCache().Lookup(aPath, version, encoded))
+        {
+            encoded = EncodeAndCacheEmberAttributeReport(aPath, version, attributeMetadata);
+        }
+        if (!encoded.empty())
+        {
+            return aAttributeReports.GetWriter()->PutPreEncodedContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure,
+                                                                         encoded.data(), static_cast<uint32_t>(encoded.size()));
+        }
+    }
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+
+    // data available, return the corresponding record
+    AttributeReportIB::Builder & attributeReport = aAttributeReports.CreateAttributeReport();
+    ReturnErrorOnFailure(aAttributeReports.GetError());
+
+    return EncodeEmberAttributeReport(attributeReport, aPath, version, attributeMetadata);
+}
+
 namespace {
 
 template <typename T>
@@ -809,5 +896,18 @@ Protocols::InteractionModel::Status CheckEventSupportStatus(const ConcreteEventP
     return Status::Success;
 }
 
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+namespace Compatibility {
+namespace {
+EncodedAttributeCache gEncodedAttributeCache;
+} // namespace
+
+EncodedAttributeCache & GetEncodedAttributeCache()
+{
+    return gEncodedAttributeCache;
+}
+} // namespace Compatibility
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+
 } // namespace app
 } // namespace chip
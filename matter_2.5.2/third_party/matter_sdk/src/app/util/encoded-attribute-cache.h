@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+#include <string.h>
+
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+
+namespace chip {
+namespace app {
+namespace Compatibility {
+
+/**
+ * Keeps the members of recently encoded AttributeReportIB structures for Ember-stored attributes, keyed by concrete path
+ * and cluster data version.
+ *
+ * The encoding of such an attribute does not depend on the subscriber once access control has passed, so when several
+ * subscriptions report the same change the value is encoded once and then copied into every report.
+ *
+ * Entries are matched on data version, but Ember writes that do not mark the attribute dirty change the value without
+ * bumping the version, so every Ember storage write must call Invalidate() for its path.
+ */
+class EncodedAttributeCache
+{
+public:
+    static constexpr size_t kEntryCount   = CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE;
+    static constexpr size_t kMaxEntrySize = CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRY_SIZE;
+
+    /**
+     * Returns whether an encoding of aPath at aDataVersion is cached, and if so sets aEncoded to the AttributeReportIB members.
+     * aEncoded is only valid until the next call to Store().
+     */
+    bool Lookup(const ConcreteAttributePath & aPath, DataVersion aDataVersion, ByteSpan & aEncoded) const
+    {
+        for (const Entry & entry : mEntries)
+        {
+            if (entry.length != 0 && entry.dataVersion == aDataVersion && entry.path == aPath)
+            {
+                aEncoded = ByteSpan(entry.data, entry.length);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Caches the AttributeReportIB members for aPath at aDataVersion, replacing the oldest entry, and returns the cached
+     * copy. Encodings that do not fit in an entry are not cached and an empty span is returned.
+     */
+    ByteSpan Store(const ConcreteAttributePath & aPath, DataVersion aDataVersion, ByteSpan aEncoded)
+    {
+        if (aEncoded.empty() || aEncoded.size() > kMaxEntrySize)
+        {
+            return ByteSpan();
+        }
+
+        Entry & entry     = mEntries[mNextEntry];
+        mNextEntry        = static_cast<uint8_t>((mNextEntry + 1) % kEntryCount);
+        entry.path        = aPath;
+        entry.dataVersion = aDataVersion;
+        entry.length      = static_cast<uint8_t>(aEncoded.size());
+        memcpy(entry.data, aEncoded.data(), aEncoded.size());
+        return ByteSpan(entry.data, entry.length);
+    }
+
+    /**
+     * Drops any cached encoding of aPath. Must be called whenever the stored value of the attribute changes.
+     */
+    void Invalidate(const ConcreteAttributePath & aPath)
+    {
+        for (Entry & entry : mEntries)
+        {
+            if (entry.length != 0 && entry.path == aPath)
+            {
+                entry.length = 0;
+            }
+        }
+    }
+
+private:
+    static_assert(kEntryCount <= UINT8_MAX, "Invalid encoded attribute cache size");
+    static_assert(kMaxEntrySize <= UINT8_MAX, "Encoded attribute cache entry length must fit in a uint8_t");
+
+    struct Entry
+    {
+        ConcreteAttributePath path;
+        DataVersion dataVersion = 0;
+        uint8_t length          = 0; // 0 means the entry is unused
+        uint8_t data[kMaxEntrySize];
+    };
+
+    Entry mEntries[kEntryCount];
+    uint8_t mNextEntry = 0;
+};
+
+/**
+ * Returns the encoded attribute cache shared by all Ember attribute reads.
+ */
+EncodedAttributeCache & GetEncodedAttributeCache();
+
+} // namespace Compatibility
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
@@ -854,6 +854,8 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE
+ *      * #CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRY_SIZE
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -931,6 +933,26 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE
+ *
+ * @brief Defines the number of encoded Ember attribute reports kept so that several subscribers reading the same attribute
+ *        at the same data version share one encoding. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE
+#define CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE 4
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRY_SIZE
+ *
+ * @brief Defines the largest encoded attribute report, in bytes, that fits in an encoded attribute cache entry. Large
+ *        enough for any numeric attribute and short strings; larger reports are encoded directly every time.
+ */
+#ifndef CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRY_SIZE
+#define CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRY_SIZE 48
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1237,6 +1259,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE
+ *
+ * @brief
+ *   Number of session resumption records DefaultSessionResumptionStorage keeps
+ *   in RAM in front of persistent storage, evicting the least recently used.
+ *   Lookups that hit the RAM cache do not touch persistent storage.  Set to 0
+ *   to disable the RAM cache.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE
+#define CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ * @brief
+ *   Number of peer certificate chains (RCAC, ICAC, NOC) that CASESession
+ *   remembers as already verified, evicting the least recently used.  A Sigma3
+ *   carrying a remembered chain skips chain decoding and signature verification
+ *   as long as the effective time is still within the validity period of every
+ *   certificate in the chain.  Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1759,6 +1808,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS
+ *
+ * @brief Granularity, in milliseconds, onto which the report schedulers quantise their report timers.
+ *
+ * When non-zero, report timeouts are aligned on multiples of this tick of the monotonic clock, as long as the aligned expiry
+ * still falls within the subscription's min/max interval window. Reports for subscriptions whose windows overlap then share a
+ * single wakeup instead of each arming a timer of its own. A value of 0 disables the quantisation.
+ */
+#ifndef CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS
+#define CHIP_CONFIG_REPORT_SCHEDULER_TICK_MS 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS
  *
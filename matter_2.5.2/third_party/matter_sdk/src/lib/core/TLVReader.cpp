@@ -757,8 +757,21 @@ CHIP_ERROR TLVReader::ReadElement()
 {
     CHIP_ERROR err;
     uint8_t stagingBuf[17]; // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
-    const uint8_t * p;
-    TLVElementType elemType;
+    uint8_t elemHeadBytes;
+
+    // Fast path: if the current input buffer holds the whole head of the element, which is always the case for a
+    // message held in a single buffer, decode it directly from the read point without EnsureData() or the staging buffer.
+    if (mReadPoint != nullptr && mReadPoint < mBufEnd)
+    {
+        mControlByte = *mReadPoint;
+        if (GetElementHeadLength(elemHeadBytes) == CHIP_NO_ERROR && elemHeadBytes <= (mBufEnd - mReadPoint))
+        {
+            const uint8_t * p = mReadPoint;
+            mReadPoint += elemHeadBytes;
+            mLenRead += elemHeadBytes;
+            return DecodeElementHead(p);
+        }
+    }
 
     // Make sure we have input data. Return CHIP_END_OF_TLV if no more data is available.
     err = EnsureData(CHIP_END_OF_TLV);
@@ -772,26 +785,10 @@ CHIP_ERROR TLVReader::ReadElement()
     // Get the element's control byte.
     mControlByte = *mReadPoint;
 
-    // Extract the element type from the control byte. Fail if it's invalid.
-    elemType = ElementType();
-    if (!IsValidTLVType(elemType))
-        return CHIP_ERROR_INVALID_TLV_ELEMENT;
-
-    // Extract the tag control from the control byte.
-    TLVTagControl tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
-
-    // Determine the number of bytes in the element's tag, if any.
-    uint8_t tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
-
-    // Extract the size of length/value field from the control byte.
-    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
-
-    // Determine the number of bytes in the length/value field.
-    uint8_t valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
-
-    // Determine the number of bytes in the element's 'head'. This includes: the control byte, the tag bytes (if present), the
-    // length bytes (if present), and for elements that don't have a length (e.g. integers), the value bytes.
-    uint8_t elemHeadBytes = static_cast<uint8_t>(1 + tagBytes + valOrLenBytes);
+    // Determine the number of bytes in the element's 'head'. Fail if the element type is invalid.
+    err = GetElementHeadLength(elemHeadBytes);
+    if (err != CHIP_NO_ERROR)
+        return err;
 
     // If the head of the element overlaps the end of the input buffer, read the bytes into the staging buffer
     // and arrange to parse them from there. Otherwise read them directly from the input buffer.
@@ -800,15 +797,24 @@ CHIP_ERROR TLVReader::ReadElement()
         err = ReadData(stagingBuf, elemHeadBytes);
         if (err != CHIP_NO_ERROR)
             return err;
-        p = stagingBuf;
-    }
-    else
-    {
-        p = mReadPoint;
-        mReadPoint += elemHeadBytes;
-        mLenRead += elemHeadBytes;
+        return DecodeElementHead(stagingBuf);
     }
 
+    const uint8_t * p = mReadPoint;
+    mReadPoint += elemHeadBytes;
+    mLenRead += elemHeadBytes;
+    return DecodeElementHead(p);
+}
+
+/**
+ * This is a private method that decodes the tag and length/value fields of the element head at @p p,
+ * whose control byte has already been loaded into mControlByte.
+ */
+CHIP_ERROR TLVReader::DecodeElementHead(const uint8_t * p)
+{
+    TLVElementType elemType  = ElementType();
+    TLVTagControl tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
+
     // Skip over the control byte.
     p++;
 
@@ -816,7 +822,7 @@ CHIP_ERROR TLVReader::ReadElement()
     mElemTag = ReadTag(tagControl, p);
 
     // Read the length/value field, if present.
-    switch (lenOrValFieldSize)
+    switch (GetTLVFieldSize(elemType))
     {
     case kTLVFieldSize_0Byte:
         mElemLenOrVal = 0;
@@ -971,6 +971,7 @@ protected:
     void SetContainerOpen(bool aContainerOpen) { mContainerOpen = aContainerOpen; }
 
     CHIP_ERROR ReadElement();
+    CHIP_ERROR DecodeElementHead(const uint8_t * p);
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
@@ -663,8 +663,13 @@ CHIP_ERROR TLVWriter::WriteElementHead(TLVElementType elemType, Tag tag, uint64_
         return CHIP_ERROR_TLV_CONTAINER_OPEN;
 
     uint8_t stagingBuf[17]; // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
-    uint8_t * p     = stagingBuf;
-    uint32_t tagNum = TagNumFromTag(tag);
+
+    // When even the largest possible head fits in the current buffer, which is the common case for context-tagged struct
+    // fields, build the head in place rather than staging it and copying it over with WriteData().
+    const bool inPlace = (mRemainingLen >= sizeof(stagingBuf)) && ((mMaxLen - mLenWritten) >= sizeof(stagingBuf));
+    uint8_t * headStart = inPlace ? mWritePoint : stagingBuf;
+    uint8_t * p         = headStart;
+    uint32_t tagNum     = TagNumFromTag(tag);
 
     if (IsSpecialTag(tag))
     {
@@ -758,8 +763,15 @@ CHIP_ERROR TLVWriter::WriteElementHead(TLVElementType elemType, Tag tag, uint64_
         break;
     }
 
-    uint32_t bytesStaged = static_cast<uint32_t>(p - stagingBuf);
+    uint32_t bytesStaged = static_cast<uint32_t>(p - headStart);
     VerifyOrDie(bytesStaged <= sizeof(stagingBuf));
+    if (inPlace)
+    {
+        mWritePoint += bytesStaged;
+        mRemainingLen -= bytesStaged;
+        mLenWritten += bytesStaged;
+        return CHIP_NO_ERROR;
+    }
     return WriteData(stagingBuf, bytesStaged);
 }
 
@@ -184,6 +184,10 @@ CHIP_ERROR ReliableMessageContext::SendStandaloneAckMessage()
 
     CHIP_ERROR err = GetExchangeContext()->SendMessage(Protocols::SecureChannel::MsgType::StandaloneAck, std::move(msgBuf),
                                                        BitFlags<SendMessageFlags>{ SendMessageFlags::kNoAutoRequestAck });
+    if (err == CHIP_NO_ERROR)
+    {
+        GetReliableMessageMgr()->CountStandaloneAck();
+    }
     if (IsSendErrorNonCritical(err))
     {
         ChipLogError(ExchangeManager,
@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
@@ -81,6 +82,7 @@ void ReliableMessageMgr::Shutdown()
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
     });
+    mNextRetransTime = System::Clock::Timestamp::max();
 
     mSystemLayer = nullptr;
 }
@@ -122,10 +124,21 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
+    // Nothing in the retrans table is due yet, typically because this wakeup was for an ACK.
+    if (mNextRetransTime > now)
+    {
+        return;
+    }
+
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired, and recompute the
+    // earliest deadline from the entries that remain.
+    mNextRetransTime = System::Clock::Timestamp::max();
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->nextRetransTime > now)
+        {
+            mNextRetransTime = std::min(mNextRetransTime, entry->nextRetransTime);
             return Loop::Continue;
+        }
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -168,6 +181,7 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
+            mRetransHistogram[kRetransHistogramSize - 1]++;
             mRetransTable.ReleaseObject(entry);
 
             return Loop::Continue;
@@ -295,6 +309,8 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+            mRetransHistogram[std::min<uint8_t>(entry->sendCount, CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS)]++;
+
             // Clear the entry from the retransmision table.
             ClearRetransTable(*entry);
 
@@ -379,7 +395,12 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
+    const bool wasEarliest = (entry.nextRetransTime <= mNextRetransTime);
     mRetransTable.ReleaseObject(&entry);
+    if (wasEarliest)
+    {
+        RecomputeNextRetransTime();
+    }
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
@@ -397,13 +418,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mNextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mNextRetransTime;
+    }
 
     StopTimer();
 
@@ -430,6 +448,15 @@ void ReliableMessageMgr::StartTimer()
     TicklessDebugDumpRetransTable("ReliableMessageMgr::StartTimer Dumping mRetransTable entries after setting wakeup times");
 }
 
+void ReliableMessageMgr::RecomputeNextRetransTime()
+{
+    mNextRetransTime = System::Clock::Timestamp::max();
+    mRetransTable.ForEachActiveObject([&](auto * entry) {
+        mNextRetransTime = std::min(mNextRetransTime, entry->nextRetransTime);
+        return Loop::Continue;
+    });
+}
+
 void ReliableMessageMgr::StopTimer()
 {
     mSystemLayer->CancelTimer(Timeout, this);
@@ -493,6 +520,7 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    mNextRetransTime               = std::min(mNextRetransTime, entry.nextRetransTime);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
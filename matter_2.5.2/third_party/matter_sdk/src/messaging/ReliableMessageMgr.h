@@ -30,6 +30,7 @@
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/Pool.h>
+#include <lib/support/Span.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemLayer.h>
@@ -221,6 +222,24 @@ public:
      */
     static void SetAdditionalMRPBackoffTime(const Optional<System::Clock::Timeout> & additionalTime);
 
+    /**
+     * Number of buckets in the retransmission histogram: one per retransmission count from 0 to
+     * CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS, plus one for messages that were given up on.
+     */
+    static constexpr size_t kRetransHistogramSize = CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS + 2;
+
+    /**
+     * Get the retransmission histogram.  Bucket N counts messages that were acknowledged after N
+     * retransmissions; the last bucket counts messages dropped after the maximum number of retries.
+     */
+    Span<const uint32_t> GetRetransHistogram() const { return Span<const uint32_t>(mRetransHistogram); }
+
+    /**
+     * Record that a standalone ack was sent, and get the number sent since boot.
+     */
+    void CountStandaloneAck() { mStandaloneAckCount++; }
+    uint32_t GetStandaloneAckCount() const { return mStandaloneAckCount; }
+
 private:
     /**
      * Calculates the next retransmission time for the entry
@@ -230,6 +249,11 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Recompute mNextRetransTime from the entries remaining in mRetransTable.
+     */
+    void RecomputeNextRetransTime();
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -248,6 +272,13 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Earliest nextRetransTime in mRetransTable, so StartTimer and ExecuteActions do not have to walk the table to
+    // find it.  It may be earlier than the actual earliest entry, which only costs an early wakeup.
+    System::Clock::Timestamp mNextRetransTime = System::Clock::Timestamp::max();
+
+    uint32_t mRetransHistogram[kRetransHistogramSize] = {};
+    uint32_t mStandaloneAckCount                      = 0;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 
     static System::Clock::Timeout sAdditionalMRPBackoffTime;
@@ -52,10 +52,14 @@
 #if CHIP_CONFIG_MEMORY_MGMT_PLATFORM
 
 extern "C" void memMonitoringTrackAlloc(void * ptr, size_t size);
+extern "C" void memMonitoringTrackAllocSite(void * ptr, size_t size, void * site);
 extern "C" void memMonitoringTrackFree(void * ptr, size_t size);
+extern "C" bool memMonitoringTrackReallocFree(void * ptr, size_t * size, void ** site);
+extern "C" void memMonitoringTrackReallocFailed(void * ptr, size_t size, void * site);
 
+// The allocation site is the return address of the chip::Platform allocation function, i.e. its caller.
 #ifndef trackAlloc
-#define trackAlloc(pvAddress, uiSize) memMonitoringTrackAlloc(pvAddress, uiSize)
+#define trackAlloc(pvAddress, uiSize) memMonitoringTrackAllocSite(pvAddress, uiSize, __builtin_return_address(0))
 #endif
 #ifndef trackFree
 #define trackFree(pvAddress, uiSize) memMonitoringTrackFree(pvAddress, uiSize)
@@ -128,8 +132,23 @@ void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
 
-    p = realloc(p, size);
-    return p;
+    // Report the old block as freed before realloc() releases it, otherwise another task could be handed the same address
+    // in between and have its allocation dropped instead. Keep its size and site so it can be recorded again if realloc() fails.
+    size_t oldSize  = 0;
+    void * oldSite  = nullptr;
+    bool oldTracked = (p != nullptr) && memMonitoringTrackReallocFree(p, &oldSize, &oldSite);
+    void * ptr      = realloc(p, size);
+    if (ptr != nullptr || size != 0)
+    {
+        // The new block is reported as a fresh allocation, or as a failed one
+        trackAlloc(ptr, size);
+    }
+    if (ptr == nullptr && size != 0 && oldTracked)
+    {
+        // realloc() failed and left the old block allocated
+        memMonitoringTrackReallocFailed(p, oldSize, oldSite);
+    }
+    return ptr;
 }
 
 void MemoryFree(void * p)
@@ -148,6 +167,16 @@ bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 } // namespace chip
 
 extern "C" __attribute__((weak)) void memMonitoringTrackAlloc(void * ptr, size_t size) {}
+extern "C" __attribute__((weak)) void memMonitoringTrackAllocSite(void * ptr, size_t size, void * site)
+{
+    memMonitoringTrackAlloc(ptr, size);
+}
 extern "C" __attribute__((weak)) void memMonitoringTrackFree(void * ptr, size_t size) {}
+extern "C" __attribute__((weak)) bool memMonitoringTrackReallocFree(void * ptr, size_t * size, void ** site)
+{
+    memMonitoringTrackFree(ptr, 0);
+    return false;
+}
+extern "C" __attribute__((weak)) void memMonitoringTrackReallocFailed(void * ptr, size_t size, void * site) {}
 
 #endif // CHIP_CONFIG_MEMORY_MGMT_PLATFORM
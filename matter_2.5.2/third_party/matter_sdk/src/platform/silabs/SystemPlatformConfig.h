@@ -36,6 +36,9 @@ struct ChipDeviceEvent;
 // ==================== Platform Adaptations ====================
 #define CHIP_SYSTEM_CONFIG_PLATFORM_PROVIDES_TIME 1
 #define CHIP_SYSTEM_CONFIG_EVENT_OBJECT_TYPE const struct ::chip::DeviceLayer::ChipDeviceEvent *
-#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 8
+// Seven full-size buffers plus ten small ones take about the same RAM as eight full-size buffers, while letting
+// acknowledgements and other short messages stay in flight alongside reports.
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 7
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE 10
 
 // ========== Platform-specific Configuration Overrides =========
@@ -117,6 +117,16 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     size_t out_length               = 0;
     size_t tag_out_length           = 0;
 
+    if (plaintext_length > 0 && tag == ciphertext + plaintext_length)
+    {
+        // The tag directly follows the ciphertext, which is the layout the single-part API produces. That lets
+        // the crypto engine run the whole CCM operation as one command instead of one per multi-part step.
+        status = psa_aead_encrypt(key.As<psa_key_id_t>(), algorithm, nonce, nonce_length, aad, aad_length, plaintext,
+                                  plaintext_length, ciphertext, plaintext_length + tag_length, &out_length);
+        VerifyOrReturnError(status == PSA_SUCCESS && out_length == plaintext_length + tag_length, CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    }
+
     status = psa_aead_encrypt_setup(&operation, key.As<psa_key_id_t>(), algorithm);
     VerifyOrReturnError(status == PSA_SUCCESS, CHIP_ERROR_INTERNAL);
 
@@ -212,6 +222,15 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     psa_status_t status             = PSA_SUCCESS;
     size_t out_length               = 0;
 
+    if (ciphertext_length > 0 && tag == ciphertext + ciphertext_length)
+    {
+        // Tag directly follows the ciphertext: verify and decrypt as a single crypto engine command.
+        status = psa_aead_decrypt(key.As<psa_key_id_t>(), algorithm, nonce, nonce_length, aad, aad_length, ciphertext,
+                                  ciphertext_length + tag_length, plaintext, ciphertext_length, &out_length);
+        VerifyOrReturnError(status == PSA_SUCCESS && out_length == ciphertext_length, CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    }
+
     status = psa_aead_decrypt_setup(&operation, key.As<psa_key_id_t>(), algorithm);
     VerifyOrReturnError(status == PSA_SUCCESS, CHIP_ERROR_INTERNAL);
 
@@ -121,6 +121,138 @@ constexpr uint8_t kTBEData3_Nonce[] =
 constexpr size_t kTBEDataNonceLength = sizeof(kTBEData2_Nonce);
 static_assert(sizeof(kTBEData2_Nonce) == sizeof(kTBEData3_Nonce), "TBEData2_Nonce and TBEData3_Nonce must be same size");
 
+#if CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+namespace {
+
+/**
+ * Remembers peer certificate chains that passed FabricTable::VerifyCredentials, keyed by a SHA-256 fingerprint of the
+ * chain, together with the identity extracted from them.  Only used with the default certificate validity policy, and
+ * only accessed from the Matter thread.
+ */
+class VerifiedCertChainCache
+{
+public:
+    struct Entry
+    {
+        uint8_t mFingerprint[kSHA256_Hash_Length];
+        FabricId mFabricId;
+        NodeId mNodeId;
+        P256PublicKey mNocPublicKey;
+        // Latest NotBefore and earliest NotAfter across the chain, in CHIP epoch seconds
+        uint32_t mNotBefore;
+        uint32_t mNotAfter;
+        // 0 marks an unused entry
+        uint32_t mLastUsed = 0;
+    };
+
+    static CHIP_ERROR ComputeFingerprint(const ByteSpan & rcac, const ByteSpan & icac, const ByteSpan & noc,
+                                         uint8_t (&fingerprint)[kSHA256_Hash_Length])
+    {
+        // Each certificate is hashed as a presence marker, a 32-bit little-endian length and its bytes, so that the
+        // boundaries between certificates, and an absent ICAC, cannot be shifted without changing the fingerprint.
+        Hash_SHA256_stream hash;
+        MutableByteSpan fingerprintSpan(fingerprint);
+        ReturnErrorOnFailure(hash.Begin());
+        ReturnErrorOnFailure(AddCertToFingerprint(hash, rcac));
+        ReturnErrorOnFailure(AddCertToFingerprint(hash, icac));
+        ReturnErrorOnFailure(AddCertToFingerprint(hash, noc));
+        return hash.Finish(fingerprintSpan);
+    }
+
+    const Entry * Find(const uint8_t (&fingerprint)[kSHA256_Hash_Length], const ValidationContext & context)
+    {
+        VerifyOrReturnValue(context.mValidityPolicy == nullptr, nullptr);
+
+        for (auto & entry : mEntries)
+        {
+            if (entry.mLastUsed == 0 || memcmp(entry.mFingerprint, fingerprint, sizeof(fingerprint)) != 0)
+            {
+                continue;
+            }
+
+            // Outside of the validity period, fall back to full verification so the caller gets the usual error.
+            if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
+            {
+                uint32_t now = context.mEffectiveTime.Get<CurrentChipEpochTime>().count();
+                VerifyOrReturnValue(now >= entry.mNotBefore, nullptr);
+                VerifyOrReturnValue(entry.mNotAfter == kNullCertTime || now <= entry.mNotAfter, nullptr);
+            }
+            else if (context.mEffectiveTime.Is<LastKnownGoodChipEpochTime>())
+            {
+                uint32_t lastKnownGood = context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count();
+                VerifyOrReturnValue(entry.mNotAfter == kNullCertTime || lastKnownGood <= entry.mNotAfter, nullptr);
+            }
+
+            entry.mLastUsed = ++mUseCounter;
+            return &entry;
+        }
+        return nullptr;
+    }
+
+    void Add(const uint8_t (&fingerprint)[kSHA256_Hash_Length], const ByteSpan & rcac, const ByteSpan & icac, const ByteSpan & noc,
+             FabricId fabricId, NodeId nodeId, const P256PublicKey & nocPublicKey)
+    {
+        uint32_t notBefore = 0;
+        uint32_t notAfter  = kNullCertTime;
+        {
+            auto certData = Platform::MakeUnique<ChipCertificateData>();
+            VerifyOrReturn(certData);
+            for (const ByteSpan & cert : { rcac, icac, noc })
+            {
+                if (cert.empty())
+                {
+                    continue;
+                }
+                VerifyOrReturn(DecodeChipCert(cert, *certData) == CHIP_NO_ERROR);
+                notBefore = std::max(notBefore, certData->mNotBeforeTime);
+                if (certData->mNotAfterTime != kNullCertTime && (notAfter == kNullCertTime || certData->mNotAfterTime < notAfter))
+                {
+                    notAfter = certData->mNotAfterTime;
+                }
+            }
+        }
+
+        // Take a free entry, or evict the least recently used one.
+        Entry * slot = &mEntries[0];
+        for (auto & entry : mEntries)
+        {
+            if (entry.mLastUsed < slot->mLastUsed)
+            {
+                slot = &entry;
+            }
+        }
+
+        memcpy(slot->mFingerprint, fingerprint, sizeof(fingerprint));
+        slot->mFabricId     = fabricId;
+        slot->mNodeId       = nodeId;
+        slot->mNocPublicKey = nocPublicKey;
+        slot->mNotBefore    = notBefore;
+        slot->mNotAfter     = notAfter;
+        slot->mLastUsed     = ++mUseCounter;
+    }
+
+private:
+    static CHIP_ERROR AddCertToFingerprint(Hash_SHA256_stream & hash, const ByteSpan & cert)
+    {
+        uint8_t header[1 + sizeof(uint32_t)];
+        Encoding::LittleEndian::BufferWriter writer(header, sizeof(header));
+
+        VerifyOrReturnError(CanCastTo<uint32_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        writer.Put8(cert.empty() ? 0 : 1).Put32(static_cast<uint32_t>(cert.size()));
+        VerifyOrReturnError(writer.Fit(), CHIP_ERROR_INTERNAL);
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(header)));
+        return cert.empty() ? CHIP_NO_ERROR : hash.AddData(cert);
+    }
+
+    Entry mEntries[CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE];
+    uint32_t mUseCounter = 0;
+};
+
+VerifiedCertChainCache gVerifiedCertChainCache;
+
+} // namespace
+#endif // CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
 // Amounts of time to allow for server-side processing of messages.
 //
 // These timeout values only allow for the server-side processing and assume that any transport-specific
@@ -371,6 +503,16 @@ struct CASESession::HandleSigma3Data
     NodeId initiatorNodeId;
 
     ValidationContext validContext;
+
+    // Identity extracted from the initiator's certificate chain, either by HandleSigma3b or from the verified chain cache
+    FabricId initiatorFabricId;
+    P256PublicKey initiatorPublicKey;
+    bool initiatorChainCached = false;
+#if CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    // The fingerprint is only valid, and the cache only used, if hashing the chain succeeded
+    bool initiatorChainFingerprinted = false;
+    uint8_t initiatorChainFingerprint[kSHA256_Hash_Length];
+#endif // CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
 };
 
 CASESession::~CASESession()
@@ -1866,6 +2008,25 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             }
         }
 
+#if CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+        // A chain this node already verified only needs its identity copied out, HandleSigma3b then skips verification.
+        // The cache is only an optimisation: if the chain cannot be hashed, it is left out and the chain is fully verified.
+        CHIP_ERROR fingerprintErr = VerifiedCertChainCache::ComputeFingerprint(data.fabricRCAC, data.initiatorICAC,
+                                                                               data.initiatorNOC, data.initiatorChainFingerprint);
+        data.initiatorChainFingerprinted = (fingerprintErr == CHIP_NO_ERROR);
+        if (data.initiatorChainFingerprinted)
+        {
+            const auto * cached = gVerifiedCertChainCache.Find(data.initiatorChainFingerprint, data.validContext);
+            if (cached != nullptr)
+            {
+                data.initiatorFabricId    = cached->mFabricId;
+                data.initiatorNodeId      = cached->mNodeId;
+                data.initiatorPublicKey   = cached->mNocPublicKey;
+                data.initiatorChainCached = true;
+            }
+        }
+#endif // CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
         SuccessOrExit(err = helper->ScheduleWork());
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
@@ -1886,12 +2047,14 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     // Step 5/6
     // Validate initiator identity located in msg->Start()
     // Constructing responder identity
-    CompressedFabricId unused;
-    FabricId initiatorFabricId;
-    P256PublicKey initiatorPublicKey;
-    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
-                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
-    VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    if (!data.initiatorChainCached)
+    {
+        CompressedFabricId unused;
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                            data.validContext, unused, data.initiatorFabricId,
+                                                            data.initiatorNodeId, data.initiatorPublicKey));
+    }
+    VerifyOrReturnError(data.fabricId == data.initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // TODO - Validate message signature prior to validating the received operational credentials.
     //        The op cert check requires traversal of cert chain, that is a more expensive operation.
@@ -1899,8 +2062,8 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     //        current flow of code, a malicious node can trigger a DoS style attack on the device.
     //        The same change should be made in Sigma2 processing.
     // Step 7 - Validate Signature
-    ReturnErrorOnFailure(
-        initiatorPublicKey.ECDSA_validate_msg_signature(data.msg_R3_Signed.Get(), data.msg_r3_signed_len, data.tbsData3Signature));
+    ReturnErrorOnFailure(data.initiatorPublicKey.ECDSA_validate_msg_signature(data.msg_R3_Signed.Get(), data.msg_r3_signed_len,
+                                                                              data.tbsData3Signature));
 
     return CHIP_NO_ERROR;
 }
@@ -1913,6 +2076,14 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
     SuccessOrExit(err = status);
 
+#if CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    if (data.initiatorChainFingerprinted && !data.initiatorChainCached && data.validContext.mValidityPolicy == nullptr)
+    {
+        gVerifiedCertChainCache.Add(data.initiatorChainFingerprint, data.fabricRCAC, data.initiatorICAC, data.initiatorNOC,
+                                    data.initiatorFabricId, data.initiatorNodeId, data.initiatorPublicKey);
+    }
+#endif // CHIP_CONFIG_CASE_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
     mPeerNodeId = data.initiatorNodeId;
 
     {
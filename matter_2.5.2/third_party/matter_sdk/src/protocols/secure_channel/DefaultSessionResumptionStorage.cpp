@@ -22,16 +22,123 @@
 
 namespace chip {
 
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+DefaultSessionResumptionStorage::CachedState * DefaultSessionResumptionStorage::CacheFind(const ScopedNodeId & node)
+{
+    for (auto & entry : mCache)
+    {
+        if (entry.mLastUsed != 0 && entry.mNode == node)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+DefaultSessionResumptionStorage::CachedState * DefaultSessionResumptionStorage::CacheFind(ConstResumptionIdView resumptionId)
+{
+    for (auto & entry : mCache)
+    {
+        if (entry.mLastUsed != 0 &&
+            std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void DefaultSessionResumptionStorage::CacheStore(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                 const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    CachedState * slot = CacheFind(node);
+    if (slot == nullptr)
+    {
+        // Take a free entry, or evict the least recently used one.
+        slot = &mCache[0];
+        for (auto & entry : mCache)
+        {
+            if (entry.mLastUsed < slot->mLastUsed)
+            {
+                slot = &entry;
+            }
+        }
+    }
+
+    slot->mNode = node;
+    std::copy(resumptionId.begin(), resumptionId.end(), slot->mResumptionId.begin());
+    slot->mSharedSecret = sharedSecret;
+    slot->mPeerCATs     = peerCATs;
+    CacheTouch(*slot);
+}
+
+void DefaultSessionResumptionStorage::CacheClear(CachedState & entry)
+{
+    entry.mNode = ScopedNodeId();
+    entry.mResumptionId.fill(0);
+    entry.mSharedSecret = Crypto::P256ECDHDerivedSecret();
+    entry.mPeerCATs     = kUndefinedCATs;
+    entry.mLastUsed     = 0;
+}
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+
+void DefaultSessionResumptionStorage::WarmCache()
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    SessionIndex index;
+    VerifyOrReturn(LoadIndex(index) == CHIP_NO_ERROR);
+
+    // The index is in save order, so walk it oldest first and let the newest records win the cache entries.
+    for (size_t i = 0; i < index.mSize; ++i)
+    {
+        ResumptionIdStorage resumptionId;
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+        CATValues peerCATs;
+        if (LoadState(index.mNodes[i], resumptionId, sharedSecret, peerCATs) == CHIP_NO_ERROR)
+        {
+            CacheStore(index.mNodes[i], ConstResumptionIdView(resumptionId), sharedSecret, peerCATs);
+        }
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+}
+
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    CachedState * cached = CacheFind(node);
+    if (cached != nullptr)
+    {
+        resumptionId = cached->mResumptionId;
+        sharedSecret = cached->mSharedSecret;
+        peerCATs     = cached->mPeerCATs;
+        CacheTouch(*cached);
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+
     ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    CacheStore(node, ConstResumptionIdView(resumptionId), sharedSecret, peerCATs);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    CachedState * cached = CacheFind(resumptionId);
+    if (cached != nullptr)
+    {
+        node         = cached->mNode;
+        sharedSecret = cached->mSharedSecret;
+        peerCATs     = cached->mPeerCATs;
+        CacheTouch(*cached);
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+
     ReturnErrorOnFailure(FindNodeByResumptionId(resumptionId, node));
     ResumptionIdStorage tmpResumptionId;
     ReturnErrorOnFailure(FindByScopedNodeId(node, tmpResumptionId, sharedSecret, peerCATs));
@@ -42,6 +149,15 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionId
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
 {
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    CachedState * cached = CacheFind(resumptionId);
+    if (cached != nullptr)
+    {
+        node = cached->mNode;
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+
     ReturnErrorOnFailure(LoadLink(resumptionId, node));
     return CHIP_NO_ERROR;
 }
@@ -84,8 +200,19 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
                                  ChipLogValueX64(node.GetNodeId()), err.Format());
                 }
             }
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+            // Drop the stale record first so that a failed write cannot leave it cached.
+            CachedState * cached = CacheFind(node);
+            if (cached != nullptr)
+            {
+                CacheClear(*cached);
+            }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
             ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
             ReturnErrorOnFailure(SaveLink(resumptionId, node));
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+            CacheStore(node, resumptionId, sharedSecret, peerCATs);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
             return CHIP_NO_ERROR;
         }
     }
@@ -102,12 +229,23 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
 
     index.mNodes[index.mSize++] = node;
     ReturnErrorOnFailure(SaveIndex(index));
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    CacheStore(node, resumptionId, sharedSecret, peerCATs);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 {
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    CachedState * cached = CacheFind(node);
+    if (cached != nullptr)
+    {
+        CacheClear(*cached);
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+
     SessionIndex index;
     ReturnErrorOnFailure(LoadIndex(index));
 
@@ -183,6 +321,16 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 
 CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    for (auto & entry : mCache)
+    {
+        if (entry.mLastUsed != 0 && entry.mNode.GetFabricIndex() == fabricIndex)
+        {
+            CacheClear(entry);
+        }
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+
     CHIP_ERROR stickyErr = CHIP_NO_ERROR;
     size_t found         = 0;
     SessionIndex index;
@@ -29,6 +29,9 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   When CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE is non-zero, the most recently used records are also kept in RAM and
+ *   both lookups are served from there when possible.  Writes go through to the backing storage.
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
@@ -54,6 +57,12 @@ public:
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
 protected:
+    /**
+     * Load the most recently saved records from the backing storage into the RAM cache, so that the first resumption
+     * attempts after boot do not have to go to storage.  Errors are ignored, records that fail to load are simply not cached.
+     */
+    void WarmCache();
+
     CHIP_ERROR virtual SaveIndex(const SessionIndex & index) = 0;
     CHIP_ERROR virtual LoadIndex(SessionIndex & index)       = 0;
 
@@ -66,6 +75,29 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+#if CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
+    struct CachedState
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+        // 0 marks an unused entry
+        uint32_t mLastUsed = 0;
+    };
+
+    CachedState * CacheFind(const ScopedNodeId & node);
+    CachedState * CacheFind(ConstResumptionIdView resumptionId);
+    void CacheStore(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs);
+    void CacheTouch(CachedState & entry) { entry.mLastUsed = ++mCacheUseCounter; }
+    static void CacheClear(CachedState & entry);
+
+    CachedState mCache[CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE];
+    uint32_t mCacheUseCounter = 0;
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_RAM_CACHE_SIZE > 0
 };
 
 } // namespace chip
@@ -40,6 +40,7 @@ public:
     {
         VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
         mStorage = storage;
+        WarmCache();
         return CHIP_NO_ERROR;
     }
 
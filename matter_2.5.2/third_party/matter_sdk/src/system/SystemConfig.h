@@ -375,6 +375,34 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE
+ *
+ *  @brief
+ *      This is the number of small packet buffers kept in the internal pool, in addition to the
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE full-size ones. Allocations that fit in
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY bytes (e.g. standalone acknowledgements, status responses) are served
+ *      from this pool first and fall back to a full-size buffer when it is exhausted.
+ *
+ *      Only used when packet buffers come from the internal pool, i.e. without LwIP and with a non-zero
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE. Set to zero (0) to disable the small buffer pool.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY
+ *
+ *  @brief
+ *      The allocation size, reserved header space included, of the buffers in the small packet buffer pool.
+ *
+ *      See CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -60,10 +60,10 @@ CHIP_ERROR LayerImplFreeRTOS::StartTimer(Clock::Timeout delay, TimerCompleteCall
 
     CancelTimer(onComplete, appState);
 
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    TimerHeap::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    if (mTimerList.Add(timer) == timer)
+    if (mTimerHeap.Add(timer) == timer)
     {
         // this is the new earliest timer and so the timer needs (re-)starting provided that
         // the system is not currently processing expired timers, in which case it is left to
@@ -82,7 +82,7 @@ CHIP_ERROR LayerImplFreeRTOS::ExtendTimerTo(Clock::Timeout delay, TimerCompleteC
 
     assertChipStackLockedByCurrentThread();
 
-    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    Clock::Timeout remainingTime = mTimerHeap.GetRemainingTime(onComplete, appState);
     if (remainingTime.count() < delay.count())
     {
         return StartTimer(delay, onComplete, appState);
@@ -93,12 +93,12 @@ CHIP_ERROR LayerImplFreeRTOS::ExtendTimerTo(Clock::Timeout delay, TimerCompleteC
 
 bool LayerImplFreeRTOS::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
 {
-    return (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+    return (mTimerHeap.GetRemainingTime(onComplete, appState) > Clock::kZero);
 }
 
 Clock::Timeout LayerImplFreeRTOS::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
 {
-    return mTimerList.GetRemainingTime(onComplete, appState);
+    return mTimerHeap.GetRemainingTime(onComplete, appState);
 }
 
 void LayerImplFreeRTOS::CancelTimer(TimerCompleteCallback onComplete, void * appState)
@@ -107,7 +107,7 @@ void LayerImplFreeRTOS::CancelTimer(TimerCompleteCallback onComplete, void * app
 
     VerifyOrReturn(mLayerState.IsInitialized());
 
-    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    TimerHeap::Node * timer = mTimerHeap.Remove(onComplete, appState);
     if (timer != nullptr)
     {
         mTimerPool.Release(timer);
@@ -137,7 +137,7 @@ CHIP_ERROR LayerImplFreeRTOS::ScheduleWork(TimerCompleteCallback onComplete, voi
     // TODO: We could do something here where we compile-time condition on the
     // sizes of things and use a direct ScheduleLambda if it would fit and this
     // setup otherwise.
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerHeap::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
     CHIP_ERROR err = ScheduleLambda([this, timer] { this->mTimerPool.Invoke(timer); });
@@ -177,7 +177,7 @@ CHIP_ERROR LayerImplFreeRTOS::HandlePlatformTimer()
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
 
-    // Expire each timer in turn until an unexpired timer is reached or the timerlist is emptied.  We set the current expiration
+    // Expire each timer in turn until an unexpired timer is reached or the timer heap is emptied.  We set the current expiration
     // time outside the loop; that way timers set after the current tick will not be executed within this expiration window
     // regardless how long the processing of the currently expired timers took.
     // The platform timer API has MSEC resolution so expire any timer with less than 1 msec remaining.
@@ -187,8 +187,8 @@ CHIP_ERROR LayerImplFreeRTOS::HandlePlatformTimer()
     // (though not exactly same) as that on the sockets-based systems.
 
     size_t timersHandled    = 0;
-    TimerList::Node * timer = nullptr;
-    while ((timersHandled < CHIP_SYSTEM_CONFIG_NUM_TIMERS) && ((timer = mTimerList.PopIfEarlier(expirationTime)) != nullptr))
+    TimerHeap::Node * timer = nullptr;
+    while ((timersHandled < CHIP_SYSTEM_CONFIG_NUM_TIMERS) && ((timer = mTimerHeap.PopIfEarlier(expirationTime)) != nullptr))
     {
         mHandlingTimerComplete = true;
         mTimerPool.Invoke(timer);
@@ -196,17 +196,17 @@ CHIP_ERROR LayerImplFreeRTOS::HandlePlatformTimer()
         timersHandled++;
     }
 
-    if (!mTimerList.Empty())
+    if (!mTimerHeap.Empty())
     {
         // timers still exist so restart the platform timer.
         Clock::Timeout delay = System::Clock::kZero;
 
         Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
 
-        if (currentTime < mTimerList.Earliest()->AwakenTime())
+        if (currentTime < mTimerHeap.Earliest()->AwakenTime())
         {
             // the next timer expires in the future, so set the delay to a non-zero value
-            delay = mTimerList.Earliest()->AwakenTime() - currentTime;
+            delay = mTimerHeap.Earliest()->AwakenTime() - currentTime;
         }
 
         StartPlatformTimer(delay);
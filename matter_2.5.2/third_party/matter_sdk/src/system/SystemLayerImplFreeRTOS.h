@@ -55,8 +55,8 @@ private:
 
     CHIP_ERROR StartPlatformTimer(System::Clock::Timeout aDelay);
 
-    TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerPool<TimerHeap::Node> mTimerPool;
+    TimerHeap mTimerHeap;
     bool mHandlingTimerComplete; // true while handling any timer completion
     ObjectLifeCycle mLayerState;
 };
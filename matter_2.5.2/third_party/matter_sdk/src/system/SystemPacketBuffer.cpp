@@ -104,6 +104,27 @@ PacketBuffer * PacketBuffer::BuildFreeList()
     return static_cast<PacketBuffer *>(lHead);
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+PacketBuffer::SmallBufferPoolElement PacketBuffer::sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+
+PacketBuffer * PacketBuffer::sSmallFreeList = PacketBuffer::BuildSmallFreeList();
+
+PacketBuffer * PacketBuffer::BuildSmallFreeList()
+{
+    pbuf * lHead = nullptr;
+
+    for (int i = 0; i < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE; i++)
+    {
+        pbuf * lCursor = &sSmallBufferPool[i].Header;
+        lCursor->next  = lHead;
+        lCursor->ref   = 0;
+        lHead          = lCursor;
+    }
+
+    return static_cast<PacketBuffer *>(lHead);
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 //
 // Heap allocation for PacketBuffer objects.
@@ -606,10 +627,27 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 #endif
     LOCK_BUF_POOL();
 
-    lPacket = PacketBuffer::sFreeList;
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+    // Requests that fit in a small buffer are served from the small pool first, so that acknowledgements and other short
+    // messages do not tie up a full-size buffer. They fall back to the regular pool when the small one is exhausted.
+    lPacket = (lAllocSize <= PacketBuffer::kSmallSizeWithoutReserve) ? PacketBuffer::sSmallFreeList : nullptr;
+    if (lPacket != nullptr)
+    {
+        PacketBuffer::sSmallFreeList = lPacket->ChainedBuffer();
+        SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumSmallPacketBufs);
+    }
+    else
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+    {
+        lPacket = PacketBuffer::sFreeList;
+        if (lPacket != nullptr)
+        {
+            PacketBuffer::sFreeList = lPacket->ChainedBuffer();
+        }
+    }
+
     if (lPacket != nullptr)
     {
-        PacketBuffer::sFreeList = lPacket->ChainedBuffer();
         SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
     }
 
@@ -701,9 +739,20 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
 #endif
             aPacket->Clear();
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+            if (aPacket->IsSmallPoolBuffer())
+            {
+                SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumSmallPacketBufs);
+                aPacket->next  = sSmallFreeList;
+                sSmallFreeList = aPacket;
+            }
+            else
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
-            aPacket->next = sFreeList;
-            sFreeList     = aPacket;
+            {
+                aPacket->next = sFreeList;
+                sFreeList     = aPacket;
+            }
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif
@@ -169,6 +169,10 @@ public:
     size_t AllocSize() const
     {
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+        if (IsSmallPoolBuffer())
+            return kSmallSizeWithoutReserve;
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
         return kMaxSizeWithoutReserve;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
         return this->alloc_size;
@@ -387,6 +391,31 @@ private:
     static PacketBuffer * BuildFreeList();
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+    // Allocation size of a small PacketBuffer, reserve included.
+    static constexpr size_t kSmallSizeWithoutReserve = CHIP_SYSTEM_ALIGN_SIZE(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY, 4u);
+    static_assert(kSmallSizeWithoutReserve < kMaxSizeWithoutReserve, "small packet buffers must be smaller than regular ones");
+
+    // Memory required for a small PacketBuffer.
+    static constexpr uint16_t kSmallBlockSize = PacketBuffer::kStructureSize + kSmallSizeWithoutReserve;
+
+    typedef union
+    {
+        pbuf Header;
+        uint8_t Block[PacketBuffer::kSmallBlockSize];
+    } SmallBufferPoolElement;
+    static SmallBufferPoolElement sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+    static PacketBuffer * sSmallFreeList;
+    static PacketBuffer * BuildSmallFreeList();
+
+    bool IsSmallPoolBuffer() const
+    {
+        const uint8_t * block = reinterpret_cast<const uint8_t *>(this);
+        return block >= sSmallBufferPool[0].Block &&
+            block < sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE - 1].Block + kSmallBlockSize;
+    }
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
@@ -49,6 +49,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+ *
+ * True if the internal pool also holds a class of small packet buffers.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL && (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0)
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL
  *
@@ -44,6 +44,9 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "Packet Buffers",
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+    "Small packet buffers",
 #endif
     "Timers",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
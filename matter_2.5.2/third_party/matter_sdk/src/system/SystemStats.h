@@ -28,6 +28,7 @@
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
 #include <system/SystemConfig.h>
+#include <system/SystemPacketBufferInternal.h>
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
@@ -54,6 +55,9 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SMALL_POOL
+    kSystemLayer_NumSmallPacketBufs,
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
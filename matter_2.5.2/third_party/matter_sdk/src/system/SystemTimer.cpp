@@ -178,5 +178,201 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+bool TimerHeap::IsEarlier(const Node * a, const Node * b)
+{
+    if (a->AwakenTime() != b->AwakenTime())
+    {
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    // Equal expiration times: the timer added first expires first. The comparison tolerates sequence wraparound.
+    return static_cast<int32_t>(a->mSequence - b->mSequence) < 0;
+}
+
+size_t TimerHeap::KeySlot(TimerCompleteCallback onComplete, void * appState)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(appState) ^ reinterpret_cast<uintptr_t>(onComplete);
+    // Pointers are word aligned, so mix the higher bits down before reducing to a slot.
+    uint32_t hash = static_cast<uint32_t>(key ^ (key >> 16)) * 2654435761u;
+    return (hash >> 8) % kKeyIndexSize;
+}
+
+void TimerHeap::Place(Node * timer, size_t index)
+{
+    mHeap[index]      = timer;
+    timer->mHeapIndex = static_cast<uint16_t>(index);
+}
+
+void TimerHeap::SiftUp(size_t index)
+{
+    Node * timer = mHeap[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!IsEarlier(timer, mHeap[parent]))
+        {
+            break;
+        }
+        Place(mHeap[parent], index);
+        index = parent;
+    }
+    Place(timer, index);
+}
+
+void TimerHeap::SiftDown(size_t index)
+{
+    Node * timer = mHeap[index];
+    for (;;)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= mCount)
+        {
+            break;
+        }
+        if (child + 1 < mCount && IsEarlier(mHeap[child + 1], mHeap[child]))
+        {
+            child++;
+        }
+        if (!IsEarlier(mHeap[child], timer))
+        {
+            break;
+        }
+        Place(mHeap[child], index);
+        index = child;
+    }
+    Place(timer, index);
+}
+
+TimerHeap::Node * TimerHeap::Add(Node * add)
+{
+    VerifyOrDie(add->mHeapIndex == Node::kNotQueued);
+    VerifyOrDie(mCount < kCapacity);
+
+    add->mSequence = mNextSequence++;
+    Place(add, mCount++);
+    SiftUp(add->mHeapIndex);
+    InsertKey(add);
+    return mHeap[0];
+}
+
+TimerHeap::Node * TimerHeap::Remove(Node * remove)
+{
+    if (remove != nullptr && remove->mHeapIndex != Node::kNotQueued)
+    {
+        size_t index = remove->mHeapIndex;
+        Node * last  = mHeap[--mCount];
+        if (last != remove)
+        {
+            Place(last, index);
+            if (index > 0 && IsEarlier(last, mHeap[(index - 1) / 2]))
+            {
+                SiftUp(index);
+            }
+            else
+            {
+                SiftDown(index);
+            }
+        }
+        remove->mHeapIndex = Node::kNotQueued;
+        RemoveKey(remove);
+    }
+    return Earliest();
+}
+
+TimerHeap::Node * TimerHeap::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = FindKey(aOnComplete, aAppState);
+    Remove(timer);
+    return timer;
+}
+
+TimerHeap::Node * TimerHeap::PopEarliest()
+{
+    Node * earliest = Earliest();
+    Remove(earliest);
+    return earliest;
+}
+
+TimerHeap::Node * TimerHeap::PopIfEarlier(Clock::Timestamp t)
+{
+    if (Empty() || !(mHeap[0]->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+void TimerHeap::Clear()
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        mHeap[i]->mHeapIndex = Node::kNotQueued;
+    }
+    mCount = 0;
+    memset(mKeyIndex, 0, sizeof(mKeyIndex));
+}
+
+Clock::Timeout TimerHeap::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState) const
+{
+    Node * timer = FindKey(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+
+        if (currentTime < timer->AwakenTime())
+        {
+            return Clock::Timeout(timer->AwakenTime() - currentTime);
+        }
+    }
+    return Clock::kZero;
+}
+
+TimerHeap::Node * TimerHeap::FindKey(TimerCompleteCallback aOnComplete, void * aAppState) const
+{
+    for (size_t slot = KeySlot(aOnComplete, aAppState); mKeyIndex[slot] != nullptr; slot = (slot + 1) % kKeyIndexSize)
+    {
+        const TimerData::Callback & callback = mKeyIndex[slot]->GetCallback();
+        if (callback.GetOnComplete() == aOnComplete && callback.GetAppState() == aAppState)
+        {
+            return mKeyIndex[slot];
+        }
+    }
+    return nullptr;
+}
+
+void TimerHeap::InsertKey(Node * timer)
+{
+    size_t slot = KeySlot(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState());
+    while (mKeyIndex[slot] != nullptr)
+    {
+        slot = (slot + 1) % kKeyIndexSize;
+    }
+    mKeyIndex[slot] = timer;
+}
+
+void TimerHeap::RemoveKey(Node * timer)
+{
+    size_t slot = KeySlot(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState());
+    while (mKeyIndex[slot] != timer)
+    {
+        VerifyOrReturn(mKeyIndex[slot] != nullptr);
+        slot = (slot + 1) % kKeyIndexSize;
+    }
+
+    // Backward-shift deletion keeps every probe run contiguous, so lookups never need tombstones.
+    size_t hole = slot;
+    for (size_t next = (hole + 1) % kKeyIndexSize; mKeyIndex[next] != nullptr; next = (next + 1) % kKeyIndexSize)
+    {
+        const TimerData::Callback & callback = mKeyIndex[next]->GetCallback();
+        size_t home                          = KeySlot(callback.GetOnComplete(), callback.GetAppState());
+        // Move the entry only if its home slot does not lie cyclically within (hole, next].
+        if ((next + kKeyIndexSize - home) % kKeyIndexSize >= (next + kKeyIndexSize - hole) % kKeyIndexSize)
+        {
+            mKeyIndex[hole] = mKeyIndex[next];
+            hole            = next;
+        }
+    }
+    mKeyIndex[hole] = nullptr;
+}
+
 } // namespace System
 } // namespace chip
@@ -189,6 +189,115 @@ private:
     Node * mEarliestTimer;
 };
 
+/**
+ * Binary min-heap of `Timer`s ordered by expiration time, with an index on (callback, appState).
+ *
+ * Offers the same operations as TimerList, but adding, cancelling and expiring a timer cost O(log n) instead of
+ * a walk over every pending timer, and looking a timer up by its callback and context is a hash probe.  Timers
+ * with the same expiration time expire in the order they were added, as they do with TimerList.
+ */
+class TimerHeap
+{
+public:
+    class Node : public TimerData
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerData(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerHeap;
+        static constexpr uint16_t kNotQueued = UINT16_MAX;
+
+        uint32_t mSequence  = 0;
+        uint16_t mHeapIndex = kNotQueued;
+    };
+
+    static constexpr size_t kCapacity = CHIP_SYSTEM_CONFIG_NUM_TIMERS;
+
+    /**
+     * Add a timer to the heap. At most kCapacity timers can be queued at once.
+     *
+     * @return  The new earliest timer in the heap. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the heap, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the heap, or nullptr if the heap is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the heap contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if the heap is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the heap, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return (mCount > 0) ? mHeap[0] : nullptr; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState) const;
+
+private:
+    // Open-addressed (linear probing) index from (callback, appState) to the queued timer.
+    static constexpr size_t kKeyIndexSize = 2 * kCapacity + 1;
+
+    static bool IsEarlier(const Node * a, const Node * b);
+    static size_t KeySlot(TimerCompleteCallback onComplete, void * appState);
+
+    void Place(Node * timer, size_t index);
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    Node * FindKey(TimerCompleteCallback onComplete, void * appState) const;
+    void InsertKey(Node * timer);
+    void RemoveKey(Node * timer);
+
+    Node * mHeap[kCapacity];
+    Node * mKeyIndex[kKeyIndexSize] = {};
+    uint16_t mCount                 = 0;
+    uint32_t mNextSequence          = 0;
+
+    static_assert(kCapacity < Node::kNotQueued, "Heap indices must fit in Node::mHeapIndex");
+};
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
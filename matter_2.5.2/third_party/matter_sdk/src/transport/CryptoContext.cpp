@@ -194,7 +194,21 @@ CHIP_ERROR CryptoContext::GetAdditionalAuthData(const PacketHeader & header, uin
 CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
                                   PacketHeader & header, MessageAuthenticationCode & mac) const
 {
+    const size_t taglen = header.MICTagLength();
+
+    VerifyOrDie(taglen <= kMaxTagLen);
+
+    uint8_t tag[kMaxTagLen];
+    ReturnErrorOnFailure(Encrypt(input, input_length, output, nonce, header, MutableByteSpan(tag, taglen)));
+
+    mac.SetTag(&header, tag, taglen);
+
+    return CHIP_NO_ERROR;
+}
 
+CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
+                                  const PacketHeader & header, MutableByteSpan tag) const
+{
     const size_t taglen = header.MICTagLength();
 
     VerifyOrDie(taglen <= kMaxTagLen);
@@ -202,10 +216,10 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     VerifyOrReturnError(input != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(output != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag.size() == taglen, CHIP_ERROR_INVALID_ARGUMENT);
 
     uint8_t AAD[kMaxAADLen];
     uint16_t aadLen = sizeof(AAD);
-    uint8_t tag[kMaxTagLen];
 
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
@@ -213,30 +227,34 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     {
         ByteSpan plaintext(input, input_length);
         MutableByteSpan ciphertext(output, input_length);
-        MutableByteSpan mic(tag, taglen);
 
-        ReturnErrorOnFailure(mKeyContext->MessageEncrypt(plaintext, ByteSpan(AAD, aadLen), nonce, mic, ciphertext));
+        ReturnErrorOnFailure(mKeyContext->MessageEncrypt(plaintext, ByteSpan(AAD, aadLen), nonce, tag, ciphertext));
     }
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+        ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output,
+                                             tag.data(), taglen));
     }
 
-    mac.SetTag(&header, tag, taglen);
-
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
                                   const PacketHeader & header, const MessageAuthenticationCode & mac) const
+{
+    return Decrypt(input, input_length, output, nonce, header, ByteSpan(mac.GetTag(), header.MICTagLength()));
+}
+
+CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
+                                  const PacketHeader & header, ByteSpan mic) const
 {
     const size_t taglen = header.MICTagLength();
-    const uint8_t * tag = mac.GetTag();
+    const uint8_t * tag = mic.data();
     uint8_t AAD[kMaxAADLen];
     uint16_t aadLen = sizeof(AAD);
 
+    VerifyOrReturnError(mic.size() == taglen, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(output != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
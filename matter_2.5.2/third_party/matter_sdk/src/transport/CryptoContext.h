@@ -131,6 +131,16 @@ public:
     CHIP_ERROR Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce, PacketHeader & header,
                        MessageAuthenticationCode & mac) const;
 
+    /**
+     * @brief
+     *   Encrypt the input data and write the MIC to the given buffer.  When @a tag directly follows the
+     *   encrypted data in @a output, the crypto backend can produce both in a single AEAD operation.
+     *
+     * @param tag Output buffer for the MIC, exactly header.MICTagLength() bytes long
+     */
+    CHIP_ERROR Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
+                       const PacketHeader & header, MutableByteSpan tag) const;
+
     /**
      * @brief
      *   Decrypt the input data using keys established in the secure channel
@@ -146,6 +156,16 @@ public:
     CHIP_ERROR Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
                        const PacketHeader & header, const MessageAuthenticationCode & mac) const;
 
+    /**
+     * @brief
+     *   Decrypt the input data, checking it against the given MIC.  When @a mic directly follows @a input,
+     *   the crypto backend can verify and decrypt in a single AEAD operation.
+     *
+     * @param mic Input MIC, exactly header.MICTagLength() bytes long
+     */
+    CHIP_ERROR Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
+                       const PacketHeader & header, ByteSpan mic) const;
+
     CHIP_ERROR PrivacyEncrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
                               MessageAuthenticationCode & mac) const;
 
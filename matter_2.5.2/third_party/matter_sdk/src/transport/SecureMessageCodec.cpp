@@ -44,14 +44,15 @@ CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView
 
     ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(msgBuf));
 
-    uint8_t * data  = msgBuf->Start();
-    size_t totalLen = msgBuf->TotalLength();
+    uint8_t * data        = msgBuf->Start();
+    size_t totalLen       = msgBuf->TotalLength();
+    const uint16_t taglen = packetHeader.MICTagLength();
 
-    MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(context.Encrypt(data, totalLen, data, nonce, packetHeader, mac));
+    VerifyOrReturnError(taglen != 0, CHIP_ERROR_WRONG_ENCRYPTION_TYPE);
+    VerifyOrReturnError(msgBuf->AvailableDataLength() >= taglen, CHIP_ERROR_INVALID_ARGUMENT);
 
-    uint16_t taglen = 0;
-    ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
+    // The MIC is written straight after the ciphertext, so the crypto backend can produce both in one operation.
+    ReturnErrorOnFailure(context.Encrypt(data, totalLen, data, nonce, packetHeader, MutableByteSpan(&data[totalLen], taglen)));
 
     msgBuf->SetDataLength(totalLen + taglen);
 
@@ -76,19 +77,17 @@ CHIP_ERROR Decrypt(const CryptoContext & context, CryptoContext::ConstNonceView
     msg->SetDataLength(len);
 #endif
 
-    uint16_t footerLen = packetHeader.MICTagLength();
-    VerifyOrReturnError(footerLen <= len, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
-
-    uint16_t taglen = 0;
-    MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(mac.Decode(packetHeader, &data[len - footerLen], footerLen, &taglen));
-    VerifyOrReturnError(taglen == footerLen, CHIP_ERROR_INTERNAL);
+    const uint16_t taglen = packetHeader.MICTagLength();
+    VerifyOrReturnError(taglen != 0, CHIP_ERROR_WRONG_ENCRYPTION_TYPE_FROM_PEER);
+    VerifyOrReturnError(taglen <= len, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     len = len - taglen;
     msg->SetDataLength(len);
 
+    // The MIC is used where it sits, right after the ciphertext, so the crypto backend can check it and decrypt
+    // in one operation. Decrypting writes at most len bytes and so never touches it.
     uint8_t * plainText = msg->Start();
-    ReturnErrorOnFailure(context.Decrypt(data, len, plainText, nonce, packetHeader, mac));
+    ReturnErrorOnFailure(context.Decrypt(data, len, plainText, nonce, packetHeader, ByteSpan(&data[len], taglen)));
 
     ReturnErrorOnFailure(payloadHeader.DecodeAndConsume(msg));
     return CHIP_NO_ERROR;
@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = AllocateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId,
+                                             fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AllocateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +216,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AllocateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -339,68 +339,68 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = LookupIndex(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    uint16_t candidate = mNextSessionId;
+    for (size_t i = 0; i <= CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1; i++, candidate++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (candidate != kUnsecuredSessionId && LookupIndex(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+
+    return NullOptional;
+}
+
+void SecureSessionTable::AddToIndex(SecureSession * session)
+{
+    size_t slot = session->GetLocalSessionId() & kSessionIndexMask;
+    while (mSessionIndex[slot] != nullptr)
+    {
+        slot = (slot + 1) & kSessionIndexMask;
+    }
+    mSessionIndex[slot] = session;
+}
+
+void SecureSessionTable::RemoveFromIndex(SecureSession * session)
+{
+    size_t slot = session->GetLocalSessionId() & kSessionIndexMask;
+    while (mSessionIndex[slot] != session)
+    {
+        VerifyOrReturn(mSessionIndex[slot] != nullptr);
+        slot = (slot + 1) & kSessionIndexMask;
+    }
+
+    // Backward-shift deletion: pull later entries of the probe run into the hole so lookups never need tombstones.
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & kSessionIndexMask; mSessionIndex[next] != nullptr; next = (next + 1) & kSessionIndexMask)
+    {
+        size_t home = mSessionIndex[next]->GetLocalSessionId() & kSessionIndexMask;
+        // Move the entry only if its home slot does not lie cyclically within (hole, next].
+        if (((next - home) & kSessionIndexMask) >= ((next - hole) & kSessionIndexMask))
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            mSessionIndex[hole] = mSessionIndex[next];
+            hole                = next;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    mSessionIndex[hole] = nullptr;
+}
+
+SecureSession * SecureSessionTable::LookupIndex(uint16_t localSessionId) const
+{
+    for (size_t slot = localSessionId & kSessionIndexMask; mSessionIndex[slot] != nullptr; slot = (slot + 1) & kSessionIndexMask)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        if (mSessionIndex[slot]->GetLocalSessionId() == localSessionId)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return mSessionIndex[slot];
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
-
-    return NullOptional;
+    return nullptr;
 }
 
 } // namespace Transport
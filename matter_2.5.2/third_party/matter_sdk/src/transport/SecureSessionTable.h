@@ -29,6 +29,19 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+/**
+ * Smallest power of two that is at least twice the given pool size.
+ */
+constexpr size_t SessionIndexSizeFor(size_t poolSize)
+{
+    size_t size = 1;
+    while (size < 2 * poolSize)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +89,11 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        RemoveFromIndex(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -243,21 +260,45 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Walks the session ID space from the starting mNextSessionId clue and
+     * checks each candidate against the local session ID index.  At most
+     * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1 candidates are ever in use, so
+     * the search terminates after that many index lookups.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Allocate a session out of mEntries and add it to the local session ID index.
+     */
+    template <typename... Args>
+    SecureSession * AllocateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr)
+        {
+            AddToIndex(session);
+        }
+        return session;
+    }
+
+    /**
+     * The local session ID index is a linear-probing hash table of pointers into mEntries, sized to the
+     * next power of two of twice the pool size so that probe sequences stay short.  Local session IDs
+     * are handed out sequentially from a random start, so the low bits are used directly as the hash.
+     */
+    static constexpr size_t kSessionIndexSize = SessionIndexSizeFor(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+    static constexpr size_t kSessionIndexMask = kSessionIndexSize - 1;
+
+    void AddToIndex(SecureSession * session);
+    void RemoveFromIndex(SecureSession * session);
+    SecureSession * LookupIndex(uint16_t localSessionId) const;
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+    SecureSession * mSessionIndex[kSessionIndexSize] = {};
 
     size_t GetMaxSessionTableSize() const
     {
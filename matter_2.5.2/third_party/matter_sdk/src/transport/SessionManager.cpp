@@ -1157,16 +1157,32 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     ReturnOnFailure(mac.Decode(partialPacketHeader, &data[len - footerLen], footerLen, &taglen));
     VerifyOrReturn(taglen == footerLen);
 
+    // Each trial decryption works in place on a copy of the message. The copy is allocated once and refilled from
+    // the received message before every further attempt, so trying several keys costs a single pool buffer.
+    uint8_t * copyStart = nullptr;
+    auto refreshMsgCopy = [&msg, &msgCopy, &copyStart, len]() -> bool {
+        if (copyStart == nullptr)
+        {
+            msgCopy = msg.CloneData();
+            if (msgCopy.IsNull())
+            {
+                ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
+                return false;
+            }
+            copyStart = msgCopy->Start();
+            return true;
+        }
+        // A failed attempt only consumes header bytes from the front and trims the MIC from the back of the copy.
+        msgCopy->SetStart(copyStart);
+        memcpy(copyStart, msg->Start(), len);
+        msgCopy->SetDataLength(len);
+        return true;
+    };
+
     bool decrypted = false;
     while (!decrypted && iter->Next(groupContext))
     {
-        CryptoContext context(groupContext.keyContext);
-        msgCopy = msg.CloneData();
-        if (msgCopy.IsNull())
-        {
-            ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
-            return;
-        }
+        VerifyOrReturn(refreshMsgCopy());
 
         bool privacy = partialPacketHeader.HasPrivacyFlag();
         decrypted =
@@ -1176,12 +1192,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         if (privacy && !decrypted)
         {
             // Try processing the P=1 message again without privacy as a work-around for invalid early-SVE2 nodes.
-            msgCopy = msg.CloneData();
-            if (msgCopy.IsNull())
-            {
-                ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
-                return;
-            }
+            VerifyOrReturn(refreshMsgCopy());
             decrypted =
                 GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, false, msgCopy, mac, groupContext);
         }
@@ -25,7 +25,9 @@
 #include "AppConfig.h"
 #include "AppEvent.h"
 
+#include "HeapProfiler.h"
 #include "LEDWidget.h"
+#include "ThermostatStats.h"
 
 #ifdef DISPLAY_ENABLED
 #include "ThermostatUI.h"
@@ -89,6 +91,20 @@ CHIP_ERROR AppTask::Init()
         SILABS_LOG("BaseApplication::Init() failed");
         appError(err);
     }
+    err = ThermoStats().Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        SILABS_LOG("ThermoStats::Init() failed");
+        appError(err);
+    }
+#if HEAP_PROFILER_ENABLED
+    err = HeapProf().Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        SILABS_LOG("HeapProf::Init() failed");
+        appError(err);
+    }
+#endif // HEAP_PROFILER_ENABLED
     err = SensorMgr().Init();
     if (err != CHIP_NO_ERROR)
     {
@@ -148,6 +164,8 @@ void AppTask::AppTaskMain(void * pvParameter)
 
 void AppTask::UpdateThermoStatUI()
 {
+    ThermoStats().OnUIRefresh();
+
 #ifdef DISPLAY_ENABLED
     ThermostatUI::SetMode(TempMgr().GetMode());
     ThermostatUI::SetHeatingSetPoint(TempMgr().GetHeatingSetPoint());
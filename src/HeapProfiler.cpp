@@ -0,0 +1,342 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**********************************************************
+ * Includes
+ *********************************************************/
+
+#include "HeapProfiler.h"
+
+#if HEAP_PROFILER_ENABLED
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sl_memory_manager.h"
+
+#include <algorithm>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+
+#ifdef HEAP_MONITORING
+#error "HEAP_PROFILER_ENABLED and HEAP_MONITORING both hook the chip::Platform allocations, enable only one"
+#endif // HEAP_MONITORING
+
+/**********************************************************
+ * Defines and Constants
+ *********************************************************/
+
+using namespace chip;
+
+static_assert(HEAP_PROFILER_MAX_SITES < UINT16_MAX, "Site indexes must fit in LiveAlloc::site");
+static_assert(HEAP_PROFILER_SAMPLE_COUNT > 0, "The free heap history needs at least one sample");
+
+namespace {
+
+// Smallest size bucket covers allocations up to 1 << kFirstBucketShift bytes
+constexpr size_t kFirstBucketShift = 4;
+
+class CriticalSection
+{
+public:
+    CriticalSection() { taskENTER_CRITICAL(); }
+    ~CriticalSection() { taskEXIT_CRITICAL(); }
+};
+
+} // namespace
+
+/**********************************************************
+ * Variable declarations
+ *********************************************************/
+
+HeapProfiler HeapProfiler::sHeapProfiler;
+
+/**********************************************************
+ * chip::Platform allocation hooks, see CHIPMem-Platform.cpp
+ *********************************************************/
+
+extern "C" void memMonitoringTrackAllocSite(void * ptr, size_t size, void * site)
+{
+    HeapProf().OnAlloc(ptr, size, site);
+}
+
+extern "C" void memMonitoringTrackFree(void * ptr, size_t size)
+{
+    HeapProf().OnFree(ptr);
+}
+
+extern "C" bool memMonitoringTrackReallocFree(void * ptr, size_t * size, void ** site)
+{
+    uint32_t liveSize;
+    uintptr_t liveSite;
+    VerifyOrReturnValue(HeapProf().OnFree(ptr, &liveSize, &liveSite), false);
+    *size = liveSize;
+    *site = reinterpret_cast<void *>(liveSite);
+    return true;
+}
+
+extern "C" void memMonitoringTrackReallocFailed(void * ptr, size_t size, void * site)
+{
+    HeapProf().OnReallocFailed(ptr, static_cast<uint32_t>(size), reinterpret_cast<uintptr_t>(site));
+}
+
+/**********************************************************
+ * HeapProfiler Definitions
+ *********************************************************/
+
+CHIP_ERROR HeapProfiler::Init()
+{
+    mSampleTimer = osTimerNew(SampleTimerHandler, osTimerPeriodic, nullptr, nullptr);
+    VerifyOrReturnError(mSampleTimer != nullptr, CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(osTimerStart(mSampleTimer, pdMS_TO_TICKS(HEAP_PROFILER_SAMPLE_PERIOD_MS)) == osOK, CHIP_ERROR_INTERNAL);
+
+    // Record the heap as it is once the application is up, before any traffic
+    TakeSample();
+    return CHIP_NO_ERROR;
+}
+
+void HeapProfiler::OnAlloc(void * ptr, size_t size, void * site)
+{
+    CriticalSection lock;
+
+    if (ptr == nullptr)
+    {
+        mTotals.failures++;
+        return;
+    }
+
+    mTotals.allocs++;
+    mSizeBuckets[SizeBucket(size)]++;
+
+    if (mLiveCount >= HEAP_PROFILER_MAX_LIVE_ALLOCS)
+    {
+        // Without a live entry the matching free cannot be attributed, so leave the byte counts alone.
+        mTotals.untracked++;
+        return;
+    }
+
+    uint16_t siteIndex = FindOrAddSite(reinterpret_cast<uintptr_t>(site));
+    SiteStats & stats  = mSites[siteIndex];
+    stats.allocs++;
+    stats.liveCount++;
+    stats.liveBytes += static_cast<uint32_t>(size);
+    stats.peakLiveBytes = std::max(stats.peakLiveBytes, stats.liveBytes);
+
+    mTotals.liveBytes += static_cast<uint32_t>(size);
+    mTotals.peakLiveBytes = std::max(mTotals.peakLiveBytes, mTotals.liveBytes);
+
+    size_t slot = LiveHome(reinterpret_cast<uintptr_t>(ptr));
+    while (mLive[slot].ptr != kNoLive)
+    {
+        slot = (slot + 1) % kLiveSlots;
+    }
+    mLive[slot] = { reinterpret_cast<uintptr_t>(ptr), static_cast<uint32_t>(size), siteIndex };
+    mLiveCount++;
+}
+
+bool HeapProfiler::OnFree(void * ptr, uint32_t * size, uintptr_t * site)
+{
+    VerifyOrReturnValue(ptr != nullptr, false);
+
+    CriticalSection lock;
+
+    for (size_t slot = LiveHome(reinterpret_cast<uintptr_t>(ptr)); mLive[slot].ptr != kNoLive; slot = (slot + 1) % kLiveSlots)
+    {
+        if (mLive[slot].ptr == reinterpret_cast<uintptr_t>(ptr))
+        {
+            SiteStats & stats = mSites[mLive[slot].site];
+            stats.liveCount--;
+            stats.liveBytes -= mLive[slot].size;
+            mTotals.liveBytes -= mLive[slot].size;
+            mTotals.frees++;
+            if (size != nullptr)
+            {
+                *size = mLive[slot].size;
+            }
+            if (site != nullptr)
+            {
+                *site = stats.site;
+            }
+            RemoveLive(slot);
+            return true;
+        }
+    }
+    return false;
+}
+
+void HeapProfiler::OnReallocFailed(void * ptr, uint32_t size, uintptr_t site)
+{
+    VerifyOrReturn(ptr != nullptr);
+
+    CriticalSection lock;
+
+    // The block never left the heap, so take back the free that OnFree() counted rather than counting a new allocation.
+    mTotals.frees--;
+
+    if (mLiveCount >= HEAP_PROFILER_MAX_LIVE_ALLOCS)
+    {
+        mTotals.untracked++;
+        return;
+    }
+
+    // Sites past HEAP_PROFILER_MAX_SITES come back as address 0, which again resolves to kOtherSite.
+    uint16_t siteIndex = FindOrAddSite(site);
+    SiteStats & stats  = mSites[siteIndex];
+    stats.liveCount++;
+    stats.liveBytes += size;
+    stats.peakLiveBytes = std::max(stats.peakLiveBytes, stats.liveBytes);
+
+    mTotals.liveBytes += size;
+    mTotals.peakLiveBytes = std::max(mTotals.peakLiveBytes, mTotals.liveBytes);
+
+    size_t slot = LiveHome(reinterpret_cast<uintptr_t>(ptr));
+    while (mLive[slot].ptr != kNoLive)
+    {
+        slot = (slot + 1) % kLiveSlots;
+    }
+    mLive[slot] = { reinterpret_cast<uintptr_t>(ptr), size, siteIndex };
+    mLiveCount++;
+}
+
+HeapProfiler::Totals HeapProfiler::GetTotals() const
+{
+    CriticalSection lock;
+    return mTotals;
+}
+
+bool HeapProfiler::GetSite(size_t index, SiteStats & out) const
+{
+    CriticalSection lock;
+
+    if (index < mSiteCount)
+    {
+        out = mSites[index];
+        return true;
+    }
+    // The shared entry of the untracked sites comes last, when anything landed in it
+    if (index == mSiteCount && mSites[kOtherSite].allocs != 0)
+    {
+        out = mSites[kOtherSite];
+        return true;
+    }
+    return false;
+}
+
+uint32_t HeapProfiler::GetSizeBucketCount(size_t bucket) const
+{
+    VerifyOrReturnValue(bucket < kSizeBuckets, 0);
+
+    CriticalSection lock;
+    return mSizeBuckets[bucket];
+}
+
+uint32_t HeapProfiler::GetSizeBucketLimit(size_t bucket)
+{
+    return (bucket + 1 < kSizeBuckets) ? (1u << (bucket + kFirstBucketShift)) : 0;
+}
+
+bool HeapProfiler::GetSample(size_t index, HeapSample & out) const
+{
+    CriticalSection lock;
+
+    VerifyOrReturnValue(index < mSampleCount, false);
+    // Until the history wraps the oldest sample is at 0, afterwards it is the next one to be overwritten
+    size_t oldest = (mSampleCount < HEAP_PROFILER_SAMPLE_COUNT) ? 0 : mNextSample;
+    out           = mSamples[(oldest + index) % HEAP_PROFILER_SAMPLE_COUNT];
+    return true;
+}
+
+void HeapProfiler::ReadHeap(HeapSample & out)
+{
+    sl_memory_heap_info_t info = {};
+    sl_memory_get_heap_info(&info);
+
+    out.uptimeS          = static_cast<uint32_t>(System::SystemClock().GetMonotonicMilliseconds64().count() / 1000);
+    out.freeBytes        = static_cast<uint32_t>(info.free_size);
+    out.largestFreeBlock = static_cast<uint32_t>(info.free_block_largest_size);
+    out.freeBlockCount   = static_cast<uint32_t>(info.free_block_count);
+}
+
+size_t HeapProfiler::LiveHome(uintptr_t ptr)
+{
+    // Heap blocks are at least 8 byte aligned, drop the bits that never vary and keep the well mixed high half of the product
+    return static_cast<size_t>((static_cast<uint32_t>(ptr >> 3) * 2654435761u) >> 16) % kLiveSlots;
+}
+
+size_t HeapProfiler::SizeBucket(size_t size)
+{
+    size_t bucket = 0;
+    while (bucket + 1 < kSizeBuckets && size > GetSizeBucketLimit(bucket))
+    {
+        bucket++;
+    }
+    return bucket;
+}
+
+void HeapProfiler::SampleTimerHandler(void * arg)
+{
+    HeapProf().TakeSample();
+}
+
+uint16_t HeapProfiler::FindOrAddSite(uintptr_t site)
+{
+    for (size_t i = 0; i < mSiteCount; i++)
+    {
+        if (mSites[i].site == site)
+        {
+            return static_cast<uint16_t>(i);
+        }
+    }
+
+    VerifyOrReturnValue(mSiteCount < HEAP_PROFILER_MAX_SITES, static_cast<uint16_t>(kOtherSite));
+    mSites[mSiteCount].site = site;
+    return static_cast<uint16_t>(mSiteCount++);
+}
+
+void HeapProfiler::RemoveLive(size_t slot)
+{
+    // Backward shift deletion: pull later entries of the probe sequence into the hole so lookups never need tombstones.
+    size_t hole = slot;
+    for (size_t next = (hole + 1) % kLiveSlots; mLive[next].ptr != kNoLive; next = (next + 1) % kLiveSlots)
+    {
+        size_t home = LiveHome(mLive[next].ptr);
+        // The entry may move into the hole only if its home is not cyclically within (hole, next].
+        bool homeAfterHole = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (!homeAfterHole)
+        {
+            mLive[hole] = mLive[next];
+            hole        = next;
+        }
+    }
+    mLive[hole].ptr = kNoLive;
+    mLiveCount--;
+}
+
+void HeapProfiler::TakeSample()
+{
+    HeapSample sample;
+    ReadHeap(sample);
+
+    CriticalSection lock;
+    mSamples[mNextSample] = sample;
+    mNextSample           = (mNextSample + 1) % HEAP_PROFILER_SAMPLE_COUNT;
+    mSampleCount          = std::min<size_t>(mSampleCount + 1, HEAP_PROFILER_SAMPLE_COUNT);
+}
+
+#endif // HEAP_PROFILER_ENABLED
@@ -25,6 +25,10 @@
 #include "AppConfig.h"
 #include "AppEvent.h"
 #include "AppTask.h"
+#include "ThermostatStats.h"
+
+#include <algorithm>
+#include <stdlib.h>
 
 #if defined(SL_MATTER_USE_SI70XX_SENSOR) && SL_MATTER_USE_SI70XX_SENSOR
 #include "Si70xxSensor.h"
@@ -37,24 +41,30 @@ using namespace chip;
 using namespace chip::app;
 using namespace ::chip::DeviceLayer;
 
-constexpr EndpointId kThermostatEndpoint = 1;
-constexpr uint16_t kSensorTImerPeriodMs  = 30000; // 30s timer period
-constexpr uint16_t kMinTemperatureDelta  = 50;    // 0.5 degree Celcius
+constexpr EndpointId kThermostatEndpoint        = 1;
+constexpr uint32_t kMinSamplingPeriodMs         = SENSOR_MIN_SAMPLING_PERIOD_MS;
+constexpr uint32_t kMaxSamplingPeriodMs         = SENSOR_MAX_SAMPLING_PERIOD_MS;
+constexpr uint16_t kStableTemperatureDelta      = SENSOR_STABLE_TEMPERATURE_DELTA;
+constexpr uint16_t kReportTemperatureHysteresis = SENSOR_REPORT_HYSTERESIS;
+constexpr uint32_t kMinReportIntervalMs         = SENSOR_MIN_REPORT_INTERVAL_MS;
+
+static_assert(kMinSamplingPeriodMs > 0 && kMinSamplingPeriodMs <= kMaxSamplingPeriodMs, "Invalid sensor sampling period bounds");
 
 /**********************************************************
  * Variable declarations
  *********************************************************/
 SensorManager SensorManager::sSensorManager;
 
-#if !(defined(SL_MATTER_USE_SI70XX_SENSOR) && (SL_MATTER_USE_SI70XX_SENSOR))
-constexpr uint16_t kSimulatedReadingFrequency = (60000 / kSensorTImerPeriodMs); // Change Simulated number at each minutes
-static int16_t mSimulatedTemp[]               = { 2300, 2400, 2800, 2550, 2200, 2125, 2100, 2600, 1800, 2700 };
-#endif // !(defined(SL_MATTER_USE_SI70XX_SENSOR) && (SL_MATTER_USE_SI70XX_SENSOR))
+#if !(defined(SL_MATTER_USE_SI70XX_SENSOR) && (SL_MATTER_USE_SI70XX_SENSOR)) && !SENSOR_SIMULATION_THERMAL_MODEL
+constexpr uint32_t kSimulatedReadingPeriodMs = 60000; // Change Simulated number at each minutes
+static int16_t mSimulatedTemp[]              = { 2300, 2400, 2800, 2550, 2200, 2125, 2100, 2600, 1800, 2700 };
+#endif // !(defined(SL_MATTER_USE_SI70XX_SENSOR) && (SL_MATTER_USE_SI70XX_SENSOR)) && !SENSOR_SIMULATION_THERMAL_MODEL
 
 CHIP_ERROR SensorManager::Init()
 {
     // Create cmsisos sw timer for temp sensor timer.
-    mSensorTimer = osTimerNew(SensorTimerEventHandler, osTimerPeriodic, nullptr, nullptr);
+    // The timer is one-shot and re-armed after each sample with the adaptive period.
+    mSensorTimer = osTimerNew(SensorTimerEventHandler, osTimerOnce, nullptr, nullptr);
 
     if (mSensorTimer == NULL)
     {
@@ -68,12 +78,16 @@ CHIP_ERROR SensorManager::Init()
         SILABS_LOG("Failed to Init Sensor");
         return CHIP_ERROR_INTERNAL;
     }
+#elif SENSOR_SIMULATION_THERMAL_MODEL
+    mThermalModel.Init(SENSOR_SIMULATION_AMBIENT_TEMP, SENSOR_SIMULATION_AMBIENT_TEMP);
+    mLastModelStepMs = System::SystemClock().GetMonotonicMilliseconds64().count();
 #endif // defined(SL_MATTER_USE_SI70XX_SENSOR) && SL_MATTER_USE_SI70XX_SENSOR
 
-    // Update Temp immediatly at bootup
+    mSamplingPeriodMs  = kMinSamplingPeriodMs;
+    mNextSampleDelayMs = kMinSamplingPeriodMs;
+
+    // Update Temp immediatly at bootup, the update handler then re-arms the timer
     SensorTimerEventHandler(nullptr);
-    // Trigger periodic update
-    osTimerStart(mSensorTimer, pdMS_TO_TICKS(kSensorTImerPeriodMs));
     return CHIP_NO_ERROR;
 }
 
@@ -86,10 +100,9 @@ void SensorManager::SensorTimerEventHandler(void * arg)
     AppTask::GetAppTask().PostEvent(&event);
 }
 
-void SensorManager::TemperatureUpdateEventHandler(AppEvent * aEvent)
+int16_t SensorManager::ReadTemperature()
 {
-    int16_t temperature            = 0;
-    static int16_t lastTemperature = 0;
+    int16_t temperature = 0;
 
 #if defined(SL_MATTER_USE_SI70XX_SENSOR) && SL_MATTER_USE_SI70XX_SENSOR
     int32_t tempSum   = 0;
@@ -105,35 +118,112 @@ void SensorManager::TemperatureUpdateEventHandler(AppEvent * aEvent)
     }
     temperature = static_cast<int16_t>(tempSum / 100);
 
+#elif SENSOR_SIMULATION_THERMAL_MODEL
+    uint64_t nowMs     = System::SystemClock().GetMonotonicMilliseconds64().count();
+    uint32_t elapsedMs = static_cast<uint32_t>(nowMs - sSensorManager.mLastModelStepMs);
+    // Drive the model with the setpoints in 0.01 degree Celsius, the values kept for the display are rounded to the degree.
+    // The rounded ones are only used if the attributes cannot be read.
+    int16_t heatingSetpoint = static_cast<int16_t>(TempMgr().GetHeatingSetPoint() * 100);
+    int16_t coolingSetpoint = static_cast<int16_t>(TempMgr().GetCoolingSetPoint() * 100);
+
+    // The shell also reads and changes the model, both sides hold the stack lock
+    PlatformMgr().LockChipStack();
+    app::Clusters::Thermostat::Attributes::OccupiedHeatingSetpoint::Get(kThermostatEndpoint, &heatingSetpoint);
+    app::Clusters::Thermostat::Attributes::OccupiedCoolingSetpoint::Get(kThermostatEndpoint, &coolingSetpoint);
+    sSensorManager.mLastModelStepMs = nowMs;
+    temperature = sSensorManager.mThermalModel.Step(elapsedMs, TempMgr().GetMode(), heatingSetpoint, coolingSetpoint);
+    PlatformMgr().UnlockChipStack();
+
 #else
-    static uint8_t nbOfRepetition = 0;
-    static uint8_t simulatedIndex = 0;
-    if (simulatedIndex >= ArraySize(mSimulatedTemp))
+    // The sampling period is not fixed, derive the simulated value from the uptime instead of the number of samples
+    uint64_t nowMs        = System::SystemClock().GetMonotonicMilliseconds64().count();
+    size_t simulatedIndex = static_cast<size_t>((nowMs / kSimulatedReadingPeriodMs) % ArraySize(mSimulatedTemp));
+    temperature           = mSimulatedTemp[simulatedIndex];
+#endif // defined(SL_MATTER_USE_SI70XX_SENSOR) && SL_MATTER_USE_SI70XX_SENSOR
+
+    return temperature;
+}
+
+MarkAttributeDirty SensorManager::ProcessSample(int16_t temperature)
+{
+    uint64_t nowMs = System::SystemClock().GetMonotonicMilliseconds64().count();
+
+    // Sample less often while the temperature is stable, and go back to the fastest rate as soon as it moves.
+    if (abs(temperature - mLastSampledTemp) < kStableTemperatureDelta)
     {
-        simulatedIndex = 0;
+        mSamplingPeriodMs = std::min(mSamplingPeriodMs * 2, kMaxSamplingPeriodMs);
     }
-    temperature = mSimulatedTemp[simulatedIndex];
-
-    nbOfRepetition++;
-    if (nbOfRepetition >= kSimulatedReadingFrequency)
+    else
     {
-        simulatedIndex++;
-        nbOfRepetition = 0;
+        mSamplingPeriodMs = kMinSamplingPeriodMs;
     }
-#endif // defined(SL_MATTER_USE_SI70XX_SENSOR) && SL_MATTER_USE_SI70XX_SENSOR
+    mLastSampledTemp   = temperature;
+    mNextSampleDelayMs = mSamplingPeriodMs;
 
-    SILABS_LOG("Sensor Temp is : %d", temperature);
+    if (mHasReportedTemp && abs(temperature - mLastReportedTemp) < kReportTemperatureHysteresis)
+    {
+        return MarkAttributeDirty::kNo;
+    }
 
-    MarkAttributeDirty reportState = MarkAttributeDirty::kNo;
-    if ((temperature >= (lastTemperature + kMinTemperatureDelta)) || temperature <= (lastTemperature - kMinTemperatureDelta))
+    uint64_t elapsedMs = nowMs - mLastReportTimeMs;
+    if (mHasReportedTemp && elapsedMs < kMinReportIntervalMs)
     {
-        reportState = MarkAttributeDirty::kIfChanged;
+        // Rate limited, sample again once the next report is allowed so the change is not lost. Only the next delay is
+        // shortened, and never below the minimum sampling period, so the adaptive period keeps growing from where it was.
+        uint32_t remainingMs = static_cast<uint32_t>(kMinReportIntervalMs - elapsedMs);
+        mNextSampleDelayMs   = std::clamp(remainingMs, kMinSamplingPeriodMs, mSamplingPeriodMs);
+        return MarkAttributeDirty::kNo;
     }
 
-    lastTemperature = temperature;
+    mHasReportedTemp  = true;
+    mLastReportedTemp = temperature;
+    mLastReportTimeMs = nowMs;
+
+    // The attribute may already hold this value if a rate limited sample stored it without reporting.
+    return MarkAttributeDirty::kYes;
+}
+
+void SensorManager::TemperatureUpdateEventHandler(AppEvent * aEvent)
+{
+    uint64_t startUs    = ThermostatStats::GetTimestampUs();
+    int16_t temperature = ReadTemperature();
+
+    SILABS_LOG("Sensor Temp is : %d", temperature);
+
+    bool changed                   = (temperature != sSensorManager.mLastSampledTemp);
+    MarkAttributeDirty reportState = sSensorManager.ProcessSample(temperature);
+
     PlatformMgr().LockChipStack();
     // The SensorMagager shouldn't be aware of the Endpoint ID TODO Fix this.
     // TODO Per Spec we should also apply the Offset stored in the same cluster before saving the temp
     app::Clusters::Thermostat::Attributes::LocalTemperature::Set(kThermostatEndpoint, temperature, reportState);
+    ThermoStats().OnSensorSample(changed, reportState != MarkAttributeDirty::kNo, ThermostatStats::GetTimestampUs() - startUs);
     PlatformMgr().UnlockChipStack();
+
+    sSensorManager.ScheduleNextSample();
+}
+
+void SensorManager::ScheduleNextSample()
+{
+    if (mFixedPeriod)
+    {
+        // The periodic fallback timer fires on its own
+        return;
+    }
+
+    if (osTimerStart(mSensorTimer, pdMS_TO_TICKS(mNextSampleDelayMs)) == osOK)
+    {
+        return;
+    }
+
+    // Nothing would ever sample again, fall back to sampling at the minimum period with a periodic timer.
+    SILABS_LOG("mSensorTimer timer start failed, sampling every %lu ms", static_cast<unsigned long>(kMinSamplingPeriodMs));
+    osTimerDelete(mSensorTimer);
+    mSensorTimer = osTimerNew(SensorTimerEventHandler, osTimerPeriodic, nullptr, nullptr);
+    if (mSensorTimer == NULL || osTimerStart(mSensorTimer, pdMS_TO_TICKS(kMinSamplingPeriodMs)) != osOK)
+    {
+        SILABS_LOG("mSensorTimer fallback timer start failed");
+        return;
+    }
+    mFixedPeriod = true;
 }
@@ -25,6 +25,10 @@
 #include "AppConfig.h"
 #include "AppEvent.h"
 #include "AppTask.h"
+#include "ThermostatStats.h"
+
+#include <app/util/attribute-batch.h>
+#include <app/util/attribute-storage-null-handling.h>
 
 /**********************************************************
  * Defines and Constants
@@ -46,19 +50,28 @@ TemperatureManager TemperatureManager::sTempMgr;
 CHIP_ERROR TemperatureManager::Init()
 {
     app::DataModel::Nullable<int16_t> temp;
-    int16_t heatingSetpoint, coolingSetpoint;
-    SystemModeEnum systemMode;
+    int16_t heatingSetpoint   = 0;
+    int16_t coolingSetpoint   = 0;
+    SystemModeEnum systemMode = SystemModeEnum::kOff;
 
+    // Read the whole snapshot with a single lock and a single endpoint/cluster lookup
     PlatformMgr().LockChipStack();
-    ThermAttr::LocalTemperature::Get(kThermostatEndpoint, temp);
-    ThermAttr::OccupiedCoolingSetpoint::Get(kThermostatEndpoint, &coolingSetpoint);
-    ThermAttr::OccupiedHeatingSetpoint::Get(kThermostatEndpoint, &heatingSetpoint);
-    ThermAttr::SystemMode::Get(kThermostatEndpoint, &systemMode);
+    app::ClusterAttributeBatch batch(kThermostatEndpoint, Id);
+    batch.Read(ThermAttr::LocalTemperature::Id, temp)
+        .Read(ThermAttr::OccupiedCoolingSetpoint::Id, coolingSetpoint)
+        .Read(ThermAttr::OccupiedHeatingSetpoint::Id, heatingSetpoint)
+        .Read(ThermAttr::SystemMode::Id, systemMode);
+    Protocols::InteractionModel::Status status = batch.GetStatus();
     PlatformMgr().UnlockChipStack();
 
+    if (status != Protocols::InteractionModel::Status::Success)
+    {
+        SILABS_LOG("Failed to read thermostat attributes: 0x%02x", to_underlying(status));
+    }
+
     mCurrentTempCelsius     = ConvertToPrintableTemp((temp.IsNull()) ? static_cast<int16_t>(0.0) : temp.Value());
-    mHeatingCelsiusSetPoint = ConvertToPrintableTemp(coolingSetpoint);
-    mCoolingCelsiusSetPoint = ConvertToPrintableTemp(heatingSetpoint);
+    mHeatingCelsiusSetPoint = ConvertToPrintableTemp(heatingSetpoint);
+    mCoolingCelsiusSetPoint = ConvertToPrintableTemp(coolingSetpoint);
 
     switch (systemMode)
     {
@@ -94,7 +107,10 @@ CHIP_ERROR TemperatureManager::Init()
         break; // unknown value;
     }
 
+    // Later refreshes come from attribute change callbacks, which run with the stack locked
+    PlatformMgr().LockChipStack();
     AppTask::GetAppTask().UpdateThermoStatUI();
+    PlatformMgr().UnlockChipStack();
 
     return CHIP_NO_ERROR;
 }
@@ -117,48 +133,59 @@ int8_t TemperatureManager::ConvertToPrintableTemp(int16_t temperature)
     return static_cast<int8_t>(temperature / 100);
 }
 
-void TemperatureManager::AttributeChangeHandler(EndpointId endpointId, AttributeId attributeId, uint8_t * value, uint16_t size)
+void TemperatureManager::LocalTemperatureChangeHandler(int16_t temperature)
 {
-    switch (attributeId)
-    {
-    case ThermAttr::LocalTemperature::Id: {
-        int8_t Temp = ConvertToPrintableTemp(*((int16_t *) value));
-        SILABS_LOG("Local temp %d", Temp);
-        mCurrentTempCelsius = Temp;
-    }
-    break;
+    uint64_t startUs = ThermostatStats::GetTimestampUs();
 
-    case ThermAttr::OccupiedCoolingSetpoint::Id: {
-        int8_t coolingTemp = ConvertToPrintableTemp(*((int16_t *) value));
-        SILABS_LOG("CoolingSetpoint %d", coolingTemp);
-        mCoolingCelsiusSetPoint = coolingTemp;
-    }
-    break;
+    int8_t temp = app::NumericAttributeTraits<int16_t>::IsNullValue(temperature) ? 0 : ConvertToPrintableTemp(temperature);
+    ChipLogDetail(AppServer, "Local temp %d", temp);
+    UpdateDisplayedValue(mCurrentTempCelsius, temp);
 
-    case ThermAttr::OccupiedHeatingSetpoint::Id: {
-        int8_t heatingTemp = ConvertToPrintableTemp(*((int16_t *) value));
-        SILABS_LOG("HeatingSetpoint %d", heatingTemp);
-        mHeatingCelsiusSetPoint = heatingTemp;
-    }
-    break;
-
-    case ThermAttr::SystemMode::Id: {
-        SILABS_LOG("SystemMode %d", static_cast<uint8_t>(*value));
-        uint8_t mode = static_cast<uint8_t>(*value);
-        if (mThermMode != mode)
-        {
-            mThermMode = mode;
-        }
-    }
-    break;
+    ThermoStats().OnAttributeChange(ThermostatStats::GetTimestampUs() - startUs);
+}
+
+void TemperatureManager::CoolingSetpointChangeHandler(int16_t setpoint)
+{
+    uint64_t startUs = ThermostatStats::GetTimestampUs();
+
+    int8_t coolingTemp = ConvertToPrintableTemp(setpoint);
+    ChipLogDetail(AppServer, "CoolingSetpoint %d", coolingTemp);
+    UpdateDisplayedValue(mCoolingCelsiusSetPoint, coolingTemp);
 
-    default: {
-        SILABS_LOG("Unhandled thermostat attribute %x", attributeId);
+    ThermoStats().OnAttributeChange(ThermostatStats::GetTimestampUs() - startUs);
+}
+
+void TemperatureManager::HeatingSetpointChangeHandler(int16_t setpoint)
+{
+    uint64_t startUs = ThermostatStats::GetTimestampUs();
+
+    int8_t heatingTemp = ConvertToPrintableTemp(setpoint);
+    ChipLogDetail(AppServer, "HeatingSetpoint %d", heatingTemp);
+    UpdateDisplayedValue(mHeatingCelsiusSetPoint, heatingTemp);
+
+    ThermoStats().OnAttributeChange(ThermostatStats::GetTimestampUs() - startUs);
+}
+
+void TemperatureManager::SystemModeChangeHandler(uint8_t mode)
+{
+    uint64_t startUs = ThermostatStats::GetTimestampUs();
+
+    ChipLogDetail(AppServer, "SystemMode %d", mode);
+    UpdateDisplayedValue(mThermMode, mode);
+
+    ThermoStats().OnAttributeChange(ThermostatStats::GetTimestampUs() - startUs);
+}
+
+template <typename T>
+void TemperatureManager::UpdateDisplayedValue(T & displayedValue, T newValue)
+{
+    // Most writes do not change what is shown once rounded, skip the UI refresh for those
+    if (displayedValue == newValue)
+    {
         return;
     }
-    break;
-    }
 
+    displayedValue = newValue;
     AppTask::GetAppTask().UpdateThermoStatUI();
 }
 
@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**********************************************************
+ * Includes
+ *********************************************************/
+
+#include "ThermalModel.h"
+#include "TemperatureManager.h"
+
+/**********************************************************
+ * Defines and Constants
+ *********************************************************/
+
+constexpr float kRoomTimeConstantS      = 3600.0f;          // Room closes 63% of its gap to ambient in one hour
+constexpr float kHvacRatePerS           = 300.0f / 3600.0f; // HVAC moves the room by 3 degree Celsius per hour
+constexpr int16_t kHvacSwitchHysteresis = 25;               // 0.25 degree Celsius around the setpoints
+
+/**********************************************************
+ * ThermalModel Definitions
+ *********************************************************/
+
+void ThermalModel::Init(int16_t roomTemp, int16_t ambientTemp)
+{
+    mRoomTemp    = roomTemp;
+    mAmbientTemp = ambientTemp;
+    mHvacState   = HvacState::kIdle;
+}
+
+int16_t ThermalModel::Step(uint32_t elapsedMs, uint8_t mode, int16_t heatingSetpoint, int16_t coolingSetpoint)
+{
+    float elapsedS = static_cast<float>(elapsedMs) / 1000.0f;
+
+    mHvacState = ComputeHvacState(mode, heatingSetpoint, coolingSetpoint);
+
+    // Newton's law of cooling towards ambient, integrated in one step is stable as long as elapsedS < kRoomTimeConstantS
+    float drift = (static_cast<float>(mAmbientTemp) - mRoomTemp) * (elapsedS / kRoomTimeConstantS);
+    if (elapsedS >= kRoomTimeConstantS)
+    {
+        drift = static_cast<float>(mAmbientTemp) - mRoomTemp;
+    }
+    mRoomTemp += drift;
+
+    if (mHvacState == HvacState::kHeating)
+    {
+        mRoomTemp += kHvacRatePerS * elapsedS;
+    }
+    else if (mHvacState == HvacState::kCooling)
+    {
+        mRoomTemp -= kHvacRatePerS * elapsedS;
+    }
+
+    return GetRoomTemp();
+}
+
+ThermalModel::HvacState ThermalModel::ComputeHvacState(uint8_t mode, int16_t heatingSetpoint, int16_t coolingSetpoint) const
+{
+    bool canHeat = (mode == HEAT) || (mode == AUTO);
+    bool canCool = (mode == COOL) || (mode == AUTO);
+    int16_t temp = GetRoomTemp();
+
+    // Keep the current equipment running until the setpoint is overshot by the hysteresis
+    switch (mHvacState)
+    {
+    case HvacState::kHeating:
+        if (canHeat && temp < heatingSetpoint + kHvacSwitchHysteresis)
+        {
+            return HvacState::kHeating;
+        }
+        break;
+    case HvacState::kCooling:
+        if (canCool && temp > coolingSetpoint - kHvacSwitchHysteresis)
+        {
+            return HvacState::kCooling;
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (canHeat && temp < heatingSetpoint - kHvacSwitchHysteresis)
+    {
+        return HvacState::kHeating;
+    }
+    if (canCool && temp > coolingSetpoint + kHvacSwitchHysteresis)
+    {
+        return HvacState::kCooling;
+    }
+    return HvacState::kIdle;
+}
@@ -0,0 +1,306 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**********************************************************
+ * Includes
+ *********************************************************/
+
+#include "ThermostatStats.h"
+#include "AppConfig.h"
+#include "HeapProfiler.h"
+#include "SensorManager.h"
+
+#include <app/InteractionModelEngine.h>
+#include <app/server/Server.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/PlatformManager.h>
+#include <system/SystemClock.h>
+
+#ifdef ENABLE_CHIP_SHELL
+#include <lib/shell/Engine.h>
+#include <lib/shell/SubShellCommand.h>
+#include <lib/shell/streamer.h>
+#include <errno.h>
+#include <stdlib.h>
+#endif // ENABLE_CHIP_SHELL
+
+/**********************************************************
+ * Defines and Constants
+ *********************************************************/
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+constexpr uint64_t kMsPerHour = 3600000;
+
+namespace {
+
+uint32_t GetSchedulerReportWakeups()
+{
+    app::reporting::ReportScheduler * scheduler = app::InteractionModelEngine::GetInstance()->GetReportScheduler();
+    return (scheduler != nullptr) ? scheduler->GetReportWakeupCount() : 0;
+}
+
+uint32_t GetMrpStandaloneAcks()
+{
+    return Server::GetInstance().GetExchangeManager().GetReliableMessageMgr()->GetStandaloneAckCount();
+}
+
+} // namespace
+
+/**********************************************************
+ * Variable declarations
+ *********************************************************/
+
+ThermostatStats ThermostatStats::sThermostatStats;
+
+#ifdef ENABLE_CHIP_SHELL
+namespace {
+
+using namespace chip::Shell;
+
+void PrintCounter(const char * label, uint64_t value, uint64_t elapsedMs)
+{
+    uint64_t perHour = (elapsedMs == 0) ? 0 : (value * kMsPerHour) / elapsedMs;
+    streamer_printf(streamer_get(), "%-20s %10lu %10lu\r\n", label, static_cast<unsigned long>(value),
+                    static_cast<unsigned long>(perHour));
+}
+
+// The shell runs on its own task, the counters and the objects they are read from are only touched with the stack locked.
+CHIP_ERROR StatsCommandHandler(int argc, char ** argv)
+{
+    PlatformMgr().LockChipStack();
+    ThermostatStats::Counters counters = ThermoStats().GetCounters();
+    uint64_t elapsedMs                 = ThermoStats().GetElapsedMs();
+    uint32_t reportWakeups             = ThermoStats().GetReportWakeups();
+    uint32_t standaloneAcks            = ThermoStats().GetStandaloneAcks();
+    PlatformMgr().UnlockChipStack();
+
+    streamer_printf(streamer_get(), "Run time: %lu s\r\n", static_cast<unsigned long>(elapsedMs / 1000));
+    streamer_printf(streamer_get(), "%-20s %10s %10s\r\n", "", "total", "per hour");
+    PrintCounter("sensor samples", counters.sensorSamples, elapsedMs);
+    PrintCounter("temp changes", counters.temperatureChanges, elapsedMs);
+    PrintCounter("reports triggered", counters.reportsTriggered, elapsedMs);
+    PrintCounter("attribute changes", counters.attributeChanges, elapsedMs);
+    PrintCounter("UI refreshes", counters.uiRefreshes, elapsedMs);
+    PrintCounter("report wakeups", reportWakeups, elapsedMs);
+    PrintCounter("standalone acks", standaloneAcks, elapsedMs);
+    PrintCounter("sensor CPU us", counters.sensorCpuTimeUs, elapsedMs);
+    PrintCounter("attribute CPU us", counters.attributeCpuTimeUs, elapsedMs);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MrpCommandHandler(int argc, char ** argv)
+{
+    PlatformMgr().LockChipStack();
+    Span<const uint32_t> histogram = Server::GetInstance().GetExchangeManager().GetReliableMessageMgr()->GetRetransHistogram();
+
+    streamer_printf(streamer_get(), "MRP messages by retransmissions since boot:\r\n");
+    for (size_t i = 0; i + 1 < histogram.size(); i++)
+    {
+        streamer_printf(streamer_get(), "%10u %10lu\r\n", static_cast<unsigned>(i), static_cast<unsigned long>(histogram[i]));
+    }
+    streamer_printf(streamer_get(), "%10s %10lu\r\n", "failed", static_cast<unsigned long>(histogram.back()));
+    PlatformMgr().UnlockChipStack();
+    return CHIP_NO_ERROR;
+}
+
+#if HEAP_PROFILER_ENABLED
+CHIP_ERROR HeapCommandHandler(int argc, char ** argv)
+{
+    HeapProfiler::Totals totals = HeapProf().GetTotals();
+    HeapProfiler::HeapSample heap;
+    HeapProfiler::ReadHeap(heap);
+
+    streamer_printf(streamer_get(), "Live: %lu B, peak %lu B\r\n", static_cast<unsigned long>(totals.liveBytes),
+                    static_cast<unsigned long>(totals.peakLiveBytes));
+    streamer_printf(streamer_get(), "Allocs: %lu, frees %lu, failed %lu, untracked %lu\r\n",
+                    static_cast<unsigned long>(totals.allocs), static_cast<unsigned long>(totals.frees),
+                    static_cast<unsigned long>(totals.failures), static_cast<unsigned long>(totals.untracked));
+    streamer_printf(streamer_get(), "Free: %lu B, largest block %lu B, %lu blocks\r\n", static_cast<unsigned long>(heap.freeBytes),
+                    static_cast<unsigned long>(heap.largestFreeBlock), static_cast<unsigned long>(heap.freeBlockCount));
+
+    streamer_printf(streamer_get(), "%-10s %10s %10s %10s %10s\r\n", "site", "allocs", "live", "live B", "peak B");
+    HeapProfiler::SiteStats site;
+    for (size_t i = 0; HeapProf().GetSite(i, site); i++)
+    {
+        streamer_printf(streamer_get(), "0x%08lx %10lu %10lu %10lu %10lu\r\n", static_cast<unsigned long>(site.site),
+                        static_cast<unsigned long>(site.allocs), static_cast<unsigned long>(site.liveCount),
+                        static_cast<unsigned long>(site.liveBytes), static_cast<unsigned long>(site.peakLiveBytes));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// One record per line, comma separated and tagged with its kind, for parsing on the host:
+//   heap,totals,<allocs>,<frees>,<failed>,<untracked>,<live bytes>,<peak live bytes>
+//   heap,site,<address>,<allocs>,<live count>,<live bytes>,<peak live bytes>
+//   heap,size,<bucket limit, 0 when unbounded>,<allocs>
+//   heap,sample,<uptime s>,<free bytes>,<largest free block>,<free blocks>
+CHIP_ERROR HeapDumpCommandHandler(int argc, char ** argv)
+{
+    HeapProfiler::Totals totals = HeapProf().GetTotals();
+    streamer_printf(streamer_get(), "heap,totals,%lu,%lu,%lu,%lu,%lu,%lu\r\n", static_cast<unsigned long>(totals.allocs),
+                    static_cast<unsigned long>(totals.frees), static_cast<unsigned long>(totals.failures),
+                    static_cast<unsigned long>(totals.untracked), static_cast<unsigned long>(totals.liveBytes),
+                    static_cast<unsigned long>(totals.peakLiveBytes));
+
+    HeapProfiler::SiteStats site;
+    for (size_t i = 0; HeapProf().GetSite(i, site); i++)
+    {
+        streamer_printf(streamer_get(), "heap,site,0x%08lx,%lu,%lu,%lu,%lu\r\n", static_cast<unsigned long>(site.site),
+                        static_cast<unsigned long>(site.allocs), static_cast<unsigned long>(site.liveCount),
+                        static_cast<unsigned long>(site.liveBytes), static_cast<unsigned long>(site.peakLiveBytes));
+    }
+
+    for (size_t i = 0; i < HeapProfiler::kSizeBuckets; i++)
+    {
+        streamer_printf(streamer_get(), "heap,size,%lu,%lu\r\n", static_cast<unsigned long>(HeapProfiler::GetSizeBucketLimit(i)),
+                        static_cast<unsigned long>(HeapProf().GetSizeBucketCount(i)));
+    }
+
+    HeapProfiler::HeapSample sample;
+    for (size_t i = 0; HeapProf().GetSample(i, sample); i++)
+    {
+        streamer_printf(streamer_get(), "heap,sample,%lu,%lu,%lu,%lu\r\n", static_cast<unsigned long>(sample.uptimeS),
+                        static_cast<unsigned long>(sample.freeBytes), static_cast<unsigned long>(sample.largestFreeBlock),
+                        static_cast<unsigned long>(sample.freeBlockCount));
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // HEAP_PROFILER_ENABLED
+
+CHIP_ERROR ResetCommandHandler(int argc, char ** argv)
+{
+    PlatformMgr().LockChipStack();
+    ThermoStats().Reset();
+    PlatformMgr().UnlockChipStack();
+    return CHIP_NO_ERROR;
+}
+
+#if SENSOR_SIMULATION_THERMAL_MODEL
+CHIP_ERROR AmbientCommandHandler(int argc, char ** argv)
+{
+    // The model is stepped by the sensor handler with the stack locked
+    if (argc == 0)
+    {
+        PlatformMgr().LockChipStack();
+        int16_t ambientTemp = SensorMgr().GetThermalModel().GetAmbientTemp();
+        int16_t roomTemp    = SensorMgr().GetThermalModel().GetRoomTemp();
+        PlatformMgr().UnlockChipStack();
+
+        streamer_printf(streamer_get(), "Ambient: %d Room: %d\r\n", ambientTemp, roomTemp);
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(argc == 1, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Temperatures are entered in 0.01 degree Celsius, as they are stored in the attributes
+    char * end = nullptr;
+    errno      = 0;
+    long temp  = strtol(argv[0], &end, 10);
+    VerifyOrReturnError(errno == 0 && end != argv[0] && *end == '\0', CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(temp >= INT16_MIN && temp <= INT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    PlatformMgr().LockChipStack();
+    SensorMgr().GetThermalModel().SetAmbientTemp(static_cast<int16_t>(temp));
+    PlatformMgr().UnlockChipStack();
+    return CHIP_NO_ERROR;
+}
+#endif // SENSOR_SIMULATION_THERMAL_MODEL
+
+void RegisterThermostatCommands()
+{
+    static constexpr Command subCommands[] = {
+        { &StatsCommandHandler, "stats", "Print control loop counters, total and per hour" },
+        { &ResetCommandHandler, "reset", "Reset control loop counters" },
+        { &MrpCommandHandler, "mrp", "Print acknowledged messages by retransmission count" },
+#if HEAP_PROFILER_ENABLED
+        { &HeapCommandHandler, "heap", "Print heap usage by allocation site and the current free heap" },
+        { &HeapDumpCommandHandler, "heapdump", "Dump the heap profile as comma separated records" },
+#endif // HEAP_PROFILER_ENABLED
+#if SENSOR_SIMULATION_THERMAL_MODEL
+        { &AmbientCommandHandler, "ambient", "Get or set the simulated ambient temperature. Usage: ambient [0.01C]" },
+#endif // SENSOR_SIMULATION_THERMAL_MODEL
+    };
+
+    static constexpr Command thermostatCommand = { &SubShellCommand<ArraySize(subCommands), subCommands>, "thermostat",
+                                                   "Thermostat control loop commands" };
+
+    Engine::Root().RegisterCommands(&thermostatCommand, 1);
+}
+
+} // namespace
+#endif // ENABLE_CHIP_SHELL
+
+/**********************************************************
+ * ThermostatStats Definitions
+ *********************************************************/
+
+CHIP_ERROR ThermostatStats::Init()
+{
+    // Reset() reads the report scheduler and MRP counters, which belong to the CHIP stack
+    PlatformMgr().LockChipStack();
+    Reset();
+    PlatformMgr().UnlockChipStack();
+#ifdef ENABLE_CHIP_SHELL
+    RegisterThermostatCommands();
+#endif // ENABLE_CHIP_SHELL
+    return CHIP_NO_ERROR;
+}
+
+void ThermostatStats::Reset()
+{
+    mCounters              = {};
+    mStartTimeMs           = System::SystemClock().GetMonotonicMilliseconds64().count();
+    mReportWakeupsAtReset  = GetSchedulerReportWakeups();
+    mStandaloneAcksAtReset = GetMrpStandaloneAcks();
+}
+
+void ThermostatStats::OnSensorSample(bool changed, bool reported, uint64_t cpuTimeUs)
+{
+    mCounters.sensorSamples++;
+    mCounters.temperatureChanges += changed ? 1 : 0;
+    mCounters.reportsTriggered += reported ? 1 : 0;
+    mCounters.sensorCpuTimeUs += cpuTimeUs;
+}
+
+void ThermostatStats::OnAttributeChange(uint64_t cpuTimeUs)
+{
+    mCounters.attributeChanges++;
+    mCounters.attributeCpuTimeUs += cpuTimeUs;
+}
+
+uint64_t ThermostatStats::GetElapsedMs() const
+{
+    return System::SystemClock().GetMonotonicMilliseconds64().count() - mStartTimeMs;
+}
+
+uint32_t ThermostatStats::GetReportWakeups() const
+{
+    return GetSchedulerReportWakeups() - mReportWakeupsAtReset;
+}
+
+uint32_t ThermostatStats::GetStandaloneAcks() const
+{
+    return GetMrpStandaloneAcks() - mStandaloneAcksAtReset;
+}
+
+uint64_t ThermostatStats::GetTimestampUs()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
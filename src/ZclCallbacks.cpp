@@ -26,8 +26,11 @@
 #include <app-common/zap-generated/ids/Attributes.h>
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app/ConcreteAttributePath.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <string.h>
+
 #ifdef DIC_ENABLE
 #include "dic_control.h"
 #endif // DIC_ENABLE
@@ -35,23 +38,73 @@
 using namespace ::chip;
 using namespace ::chip::app::Clusters;
 
+namespace {
+
+using AttributeChangeHandler = void (*)(const chip::app::ConcreteAttributePath & attributePath, uint16_t size, uint8_t * value);
+
+struct AttributeChangeEntry
+{
+    ClusterId clusterId;
+    AttributeId attributeId;
+    AttributeChangeHandler handler;
+};
+
+/**
+ * Decodes the Ember storage representation of the value and forwards it to a
+ * typed TemperatureManager handler. The value buffer is not guaranteed to be
+ * aligned, hence the memcpy.
+ */
+template <typename T, void (TemperatureManager::*Handler)(T)>
+void DispatchToTempMgr(const chip::app::ConcreteAttributePath & attributePath, uint16_t size, uint8_t * value)
+{
+    VerifyOrReturn(size == sizeof(T));
+
+    T typedValue;
+    memcpy(&typedValue, value, sizeof(T));
+    (TempMgr().*Handler)(typedValue);
+}
+
+void IdentifyAttributeChanged(const chip::app::ConcreteAttributePath & attributePath, uint16_t size, uint8_t * value)
+{
+    ChipLogDetail(Zcl, "Identify attribute ID: " ChipLogFormatMEI " Value: %u, length %u",
+                  ChipLogValueMEI(attributePath.mAttributeId), *value, size);
+}
+
+// Attributes the application reacts to. Anything not listed is ignored after a single table scan.
+constexpr AttributeChangeEntry kAttributeChangeTable[] = {
+    { Thermostat::Id, Thermostat::Attributes::LocalTemperature::Id,
+      &DispatchToTempMgr<int16_t, &TemperatureManager::LocalTemperatureChangeHandler> },
+    { Thermostat::Id, Thermostat::Attributes::OccupiedCoolingSetpoint::Id,
+      &DispatchToTempMgr<int16_t, &TemperatureManager::CoolingSetpointChangeHandler> },
+    { Thermostat::Id, Thermostat::Attributes::OccupiedHeatingSetpoint::Id,
+      &DispatchToTempMgr<int16_t, &TemperatureManager::HeatingSetpointChangeHandler> },
+    { Thermostat::Id, Thermostat::Attributes::SystemMode::Id,
+      &DispatchToTempMgr<uint8_t, &TemperatureManager::SystemModeChangeHandler> },
+    { Identify::Id, Identify::Attributes::IdentifyTime::Id, &IdentifyAttributeChanged },
+    { Identify::Id, Identify::Attributes::IdentifyType::Id, &IdentifyAttributeChanged },
+};
+
+} // namespace
+
 void MatterPostAttributeChangeCallback(const chip::app::ConcreteAttributePath & attributePath, uint8_t type, uint16_t size,
                                        uint8_t * value)
 {
-    ClusterId clusterId     = attributePath.mClusterId;
-    AttributeId attributeId = attributePath.mAttributeId;
-    ChipLogProgress(Zcl, "Cluster callback: " ChipLogFormatMEI, ChipLogValueMEI(clusterId));
+    ChipLogDetail(Zcl, "Cluster callback: " ChipLogFormatMEI " attribute " ChipLogFormatMEI,
+                  ChipLogValueMEI(attributePath.mClusterId), ChipLogValueMEI(attributePath.mAttributeId));
 
-    if (clusterId == Identify::Id)
+    for (const AttributeChangeEntry & entry : kAttributeChangeTable)
     {
-        ChipLogProgress(Zcl, "Identify attribute ID: " ChipLogFormatMEI " Type: %u Value: %u, length %u",
-                        ChipLogValueMEI(attributeId), type, *value, size);
+        if (entry.attributeId == attributePath.mAttributeId && entry.clusterId == attributePath.mClusterId)
+        {
+            entry.handler(attributePath, size, value);
+            break;
+        }
     }
-    else if (clusterId == Thermostat::Id)
-    {
-        TempMgr().AttributeChangeHandler(attributePath.mEndpointId, attributeId, value, size);
+
 #ifdef DIC_ENABLE
-        dic::control::AttributeHandler(attributePath.mEndpointId, attributeId);
-#endif // DIC_ENABLE
+    if (attributePath.mClusterId == Thermostat::Id)
+    {
+        dic::control::AttributeHandler(attributePath.mEndpointId, attributePath.mAttributeId);
     }
+#endif // DIC_ENABLE
 }